@@ -0,0 +1,104 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ----------------------------------------------------------------
+// Easing Curves
+// Description: Every curve is baked once into a lookup table, so evaluating
+// an ease is an index + lerp instead of calls to sin/pow.
+// ----------------------------------------------------------------
+enum class Easing : std::uint8_t {
+    Linear,
+    QuadIn,
+    QuadOut,
+    SineInOut,
+    BackOut,   // Overshoots, then settles
+    BounceOut,
+    Count
+};
+
+class EasingTable {
+public:
+    static const std::size_t RESOLUTION = 256;
+
+    // Built on first use (at load), shared by every clip
+    static const EasingTable& Get();
+
+    // t is clamped to [0, 1]
+    float Sample(Easing easing, float t) const;
+
+private:
+    EasingTable();
+
+    std::array<std::array<float, RESOLUTION + 1>, static_cast<std::size_t>(Easing::Count)> m_tables;
+};
+
+// ----------------------------------------------------------------
+// AnimationPose
+// Description: Everything an animation can drive on a sprite at one instant.
+// Scale is relative to the entity's rest scale; offset is in pixels.
+// ----------------------------------------------------------------
+struct AnimationPose {
+    sf::Vector2f scale = sf::Vector2f(1.0f, 1.0f);
+    sf::Vector2f offset = sf::Vector2f(0.0f, 0.0f);
+    sf::Color color = sf::Color::White;
+    int frame = 0; // Spritesheet frame index
+};
+
+// A key on one track. The easing shapes the segment that ENDS at this key.
+template <typename T>
+struct Keyframe {
+    float time;
+    T value;
+    Easing easing;
+};
+
+// ----------------------------------------------------------------
+// AnimationClip
+// Description: Keyframe tracks (scale, offset, color, spritesheet frame)
+// authored once and then baked into a fixed-rate table of poses.
+// At runtime an entity only stores when its clip started; Sample() is a
+// single table lookup, so the cost is the same for every clip and entity.
+// ----------------------------------------------------------------
+class AnimationClip {
+public:
+    static const int BAKE_RATE = 120; // Poses per second of animation
+
+    AnimationClip();
+    AnimationClip(float duration, bool isLooping);
+
+    // --- Authoring (before Bake) ---
+    // Tracks with no keys keep the default pose value.
+    AnimationClip& AddScaleKey(float time, sf::Vector2f scale, Easing easing = Easing::Linear);
+    AnimationClip& AddOffsetKey(float time, sf::Vector2f offset, Easing easing = Easing::Linear);
+    AnimationClip& AddColorKey(float time, sf::Color color, Easing easing = Easing::Linear);
+    AnimationClip& AddFrameKey(float time, int frame); // Frames switch, they don't blend
+
+    // Evaluates every track at BAKE_RATE and frees the keys
+    void Bake();
+
+    // --- Playback ---
+    // elapsed = seconds since the clip started. Non-looping clips hold their last pose.
+    const AnimationPose& Sample(float elapsed) const;
+
+    float GetDuration() const { return m_duration; }
+    bool IsLooping() const { return m_isLooping; }
+    bool IsFinished(float elapsed) const { return !m_isLooping && elapsed >= m_duration; }
+
+private:
+    float m_duration;
+    bool m_isLooping;
+
+    // Authoring data (cleared by Bake)
+    std::vector<Keyframe<sf::Vector2f>> m_scaleKeys;
+    std::vector<Keyframe<sf::Vector2f>> m_offsetKeys;
+    std::vector<Keyframe<sf::Color>> m_colorKeys;
+    std::vector<Keyframe<int>> m_frameKeys;
+
+    // Baked poses
+    std::vector<AnimationPose> m_poses;
+    AnimationPose m_restPose; // Returned before baking
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+// ----------------------------------------------------------------
+// AudioMixer
+// Description: A fixed pool of reusable voices for one-shot sound effects.
+// Rapid hits no longer restart (and cut off) a single sf::Sound; each Play()
+// grabs a free voice, or steals the oldest one when the pool is saturated.
+// No allocation happens after construction.
+// ----------------------------------------------------------------
+class AudioMixer {
+public:
+    // Enough for a burst of overlapping hits without exhausting OpenAL sources
+    static const std::size_t VOICE_COUNT = 16;
+
+    AudioMixer();
+    ~AudioMixer();
+
+    // Plays a pre-decoded buffer on the next available voice.
+    // pitchVariation / volumeVariation are +/- ranges applied randomly per voice
+    // (e.g. 0.1f pitch variation gives a pitch in [0.9, 1.1]).
+    void Play(const sf::SoundBuffer& buffer, float volume = 100.0f,
+              float pitchVariation = 0.0f, float volumeVariation = 0.0f);
+
+    // Muting silences every voice immediately and drops new Play() requests.
+    void SetMuted(bool muted);
+    bool IsMuted() const { return m_isMuted; }
+
+    void StopAll();
+
+private:
+    // The Voice Pool
+    std::array<sf::Sound, VOICE_COUNT> m_voices;
+    std::array<std::uint64_t, VOICE_COUNT> m_startOrder; // When each voice was last started
+    std::uint64_t m_playCounter;
+
+    bool m_isMuted;
+
+    // Own generator (seeded per launch) for the per-voice pitch/volume variation
+    std::minstd_rand m_rng;
+
+    // Internal Helpers
+    std::size_t AcquireVoice();
+    float RandomRange(float variation);
+};
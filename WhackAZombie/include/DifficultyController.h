@@ -0,0 +1,44 @@
+#pragma once
+
+// ----------------------------------------------------------------
+// DifficultyController
+// Description: Adapts the game to the player. Hit rate and reaction time
+// are tracked as exponentially-weighted moving averages (O(1) per event,
+// no history kept), and a difficulty level is nudged every frame until the
+// player's hit rate sits inside the target accuracy band.
+//
+// Difficulty is in [-1, 1]: 0 is the designed baseline, positive values
+// spawn zombies more often and keep them up for less time.
+// ----------------------------------------------------------------
+class DifficultyController {
+public:
+    DifficultyController();
+    ~DifficultyController() = default;
+
+    // --- Event Feed ---
+    void OnHit(float reactionTime);
+    void OnMiss(); // Wasted click or escaped zombie
+
+    // Moves the difficulty toward the target band (call once per frame)
+    void Update(float deltaTime);
+
+    // --- Outputs ---
+    // Multiplier for the time between spawns (< 1 = more zombies)
+    float GetSpawnIntervalScale() const;
+    // Multiplier for how long zombies stay up (< 1 = less time to react)
+    float GetLifetimeScale() const;
+    // Shortest Active time (seconds) this player can still react in.
+    // Lifetime scaling never goes below it (0 until the first hit).
+    float GetReactionFloor() const;
+
+    // --- Statistics ---
+    float GetHitRate() const { return m_hitRate; }
+    float GetReactionTime() const { return m_reactionTime; }
+    float GetDifficulty() const { return m_difficulty; }
+
+private:
+    float m_hitRate;      // EWMA of 1 (hit) / 0 (miss)
+    float m_reactionTime; // EWMA of hittable-to-hit seconds
+    float m_difficulty;
+    int m_eventCount;     // Saturates at the warm-up threshold
+};
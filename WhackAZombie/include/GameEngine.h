@@ -6,10 +6,13 @@
 
 // Forward declarations to avoid circular dependencies
 class ResourceManager;
-class ZombieManager;
+class GameSession;
 class HUD;
+class AudioMixer;
+class TelemetryRecorder;
+class ParticleSystem;
 
-class GameEngine : public ITelemetry {
+class GameEngine {
 public:
     GameEngine();
     ~GameEngine();
@@ -17,28 +20,15 @@ public:
     // The Master Loop
     void Run();
 
-    // ITelemetry Implementation
-    int GetScore() const override { return m_score; }
-    int GetMisses() const override { return m_misses; }
-    float GetAccuracy() const override;
-
-    // Methods to modify state (called by ZombieManager)
-    void RegisterHit();
-    void RegisterMiss();
-
 private:
     // Core Systems
     sf::RenderWindow m_window;
     sf::Sprite m_backgroundSprite;
     bool m_isRunning;
 
-    // Game State
-    int m_score;
-    int m_misses;
-
     // Audio Systems
-    sf::Music m_backgroundMusic; // Streams from disk
-    sf::Sound m_hitSound;        // Plays from memory buffer
+    sf::Music m_backgroundMusic;            // Streams from disk
+    const sf::SoundBuffer* m_hitBuffer;     // Pre-decoded PCM, owned by the ResourceManager
     
     // Mute Toggle State (For the bonus points)
     bool m_isMuted;
@@ -46,11 +36,18 @@ private:
     // The Specialists (Modules)
     // We use unique_ptr for automatic memory management (RAII)
     std::unique_ptr<ResourceManager> m_resourceManager;
-    std::unique_ptr<ZombieManager> m_zombieManager;
+    std::unique_ptr<GameSession> m_session; // Zombies + score (the simulation)
     std::unique_ptr<HUD> m_hud;
+    std::unique_ptr<AudioMixer> m_audioMixer; // Voice pool for overlapping sound effects
+    std::unique_ptr<TelemetryRecorder> m_telemetryRecorder; // Session time series, streamed to disk
+    std::unique_ptr<ParticleSystem> m_particles; // Hit splatter and spawn dust
 
     // Internal Helpers
     void ProcessEvents();
     void Update(float deltaTime);
     void Render();
+
+    // Player feedback for a resolved click (the session has already scored it)
+    void OnHit(float reactionTime);
+    void OnMiss();
 };
\ No newline at end of file
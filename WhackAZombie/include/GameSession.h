@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Interface.h"
+#include "ZombieManager.h"
+#include "DifficultyController.h"
+
+// ----------------------------------------------------------------
+// GameSession
+// Description: One complete game simulation: the zombies plus the score.
+// It owns no window, clock, or audio, so the same class runs inside the
+// windowed GameEngine and, by the hundred, inside the headless server.
+// ----------------------------------------------------------------
+class GameSession : public ITelemetry {
+public:
+    // assetSupplier may be nullptr for a headless session
+    GameSession(IAssetSupplier* assetSupplier, unsigned int seed);
+    ~GameSession() = default;
+
+    // Advances the simulation. Returns the zombies that escaped this step
+    // (already added to the miss count).
+    int Update(float deltaTime);
+    void Render(sf::RenderWindow& window);
+
+    // Resolves a click in world coordinates and scores it.
+    // Only a kill scores; an absorbed hit counts as neither hit nor miss.
+    // On a kill, reactionTime (if given) receives the player's reaction time in seconds.
+    HitResult HandleClick(int x, int y, float* reactionTime = nullptr);
+
+    // ITelemetry Implementation
+    int GetScore() const override { return m_score; }
+    int GetMisses() const override { return m_misses; }
+    float GetAccuracy() const override;
+
+    // Optional visual effects hook (the windowed game's particles)
+    void SetEffectListener(IEffectListener* listener) { m_zombieManager.SetEffectListener(listener); }
+
+    int GetActiveCount() const { return m_zombieManager.GetActiveCount(); }
+    const ZombieManager& GetZombieManager() const { return m_zombieManager; }
+    const DifficultyController& GetDifficulty() const { return m_difficulty; }
+
+private:
+    ZombieManager m_zombieManager;
+    DifficultyController m_difficulty; // Tunes spawn rate / lifetime to the player
+
+    // Game State
+    int m_score;
+    int m_misses;
+
+    // Methods to modify state
+    void RegisterHit(float reactionTime);
+    void RegisterMiss();
+};
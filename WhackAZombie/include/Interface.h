@@ -4,28 +4,28 @@
 #include <string>
 
 // ----------------------------------------------------------------
-// Contract: IWhackable
+// Contract: Whackable (static)
 // Description: Defines any entity that can be spawned, hit, and drawn.
+// This is a compile-time contract rather than a virtual base class: zombie
+// kinds are stored by value in a ZombiePool and called without a vtable.
+// A kind must provide:
+//
+//   bool Update(float deltaTime);               // Per-frame logic. Returns true if it escaped (miss).
+//   void Render(sf::RenderWindow& window) const;
+//   HitResult TryHit(int x, int y);             // What the click did to it (see below).
+//   bool IsActive() const;                      // True while alive/spawning.
+//   sf::Vector2f GetPosition() const;
+//   float GetReactionTime() const;              // Seconds since it last became hittable.
+//   void Spawn(float lifetimeScale, float reactionFloor); // Wake up from the grave.
+//   void Reset();                               // Force back into the grave.
 // ----------------------------------------------------------------
-class IWhackable {
-public:
-    virtual ~IWhackable() = default;
-
-    // Called every frame to update logic (timers, animation)
-    virtual bool Update(float deltaTime) = 0;
-    
-    // Called every frame to draw the entity
-    virtual void Render(sf::RenderWindow& window) = 0;
-
-    // Checks if a click at (x, y) hits this entity
-    // Returns true if hit, false otherwise.
-    virtual bool TryHit(int x, int y) = 0;
 
-    // Returns true if the entity is currently active (alive/spawning)
-    virtual bool IsActive() const = 0;
-
-    // Returns the current position (useful for debugging or effects)
-    virtual sf::Vector2f GetPosition() const = 0;
+// Outcome of a click on one zombie. Only a kill scores; an absorbed hit
+// (armour took it) is neither a hit nor a miss.
+enum class HitResult {
+    None,     // Not touched
+    Absorbed, // Struck, but it is still standing
+    Killed    // Struck down
 };
 
 // ----------------------------------------------------------------
@@ -52,4 +52,18 @@ public:
     virtual const sf::Texture& GetTexture(const std::string& name) const = 0;
     virtual const sf::SoundBuffer& GetSound(const std::string& name) const = 0;
     virtual const sf::Font& GetFont(const std::string& name) const = 0;
-};
\ No newline at end of file
+};
+
+// ----------------------------------------------------------------
+// Contract: IEffectListener
+// Description: Lets gameplay announce moments worth a visual effect
+// (particles, screen shake) without knowing who draws them.
+// Optional: headless sessions simply have no listener.
+// ----------------------------------------------------------------
+class IEffectListener {
+public:
+    virtual ~IEffectListener() = default;
+
+    virtual void OnZombieSpawned(sf::Vector2f position) = 0;
+    virtual void OnZombieHit(sf::Vector2f position) = 0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "Interface.h"
+
+// ----------------------------------------------------------------
+// ParticleBurst
+// Description: How one burst of particles looks and moves.
+// ----------------------------------------------------------------
+struct ParticleBurst {
+    int count;
+    float speedMin, speedMax;       // Pixels per second
+    float direction, spread;        // Radians: center angle and +/- spread
+    float lifeMin, lifeMax;         // Seconds
+    float sizeMin, sizeMax;         // Pixels (square)
+    float gravity;                  // Pixels per second^2 (+ = down)
+    sf::Color color;
+    int colorVariation;             // +/- per RGB channel
+
+    // Presets
+    static ParticleBurst Splatter(); // Zombie whacked
+    static ParticleBurst Dust();     // Zombie climbing out of the grave
+};
+
+// ----------------------------------------------------------------
+// ParticleSystem
+// Description: A fixed-capacity particle store in Structure-of-Arrays layout.
+// Each attribute is its own contiguous float array, so integration is a few
+// branch-free loops the compiler can vectorise. Live particles are kept packed
+// at the front (dead ones are swap-removed), and everything is drawn with a
+// single sf::VertexArray. Nothing is allocated after construction.
+// ----------------------------------------------------------------
+class ParticleSystem : public IEffectListener {
+public:
+    static const std::size_t DEFAULT_CAPACITY = 32768;
+
+    explicit ParticleSystem(std::size_t capacity = DEFAULT_CAPACITY);
+    ~ParticleSystem() = default;
+
+    // Spawns up to burst.count particles (fewer if the pool is full)
+    void Emit(sf::Vector2f position, const ParticleBurst& burst);
+
+    void Update(float deltaTime);
+    void Render(sf::RenderWindow& window);
+
+    void Clear() { m_liveCount = 0; }
+    std::size_t GetLiveCount() const { return m_liveCount; }
+    std::size_t GetCapacity() const { return m_capacity; }
+
+    // --- IEffectListener Implementation ---
+    void OnZombieSpawned(sf::Vector2f position) override;
+    void OnZombieHit(sf::Vector2f position) override;
+
+private:
+    std::size_t m_capacity;
+    std::size_t m_liveCount;
+
+    // --- SoA Columns (all sized to capacity) ---
+    std::vector<float> m_posX, m_posY;
+    std::vector<float> m_velX, m_velY;
+    std::vector<float> m_gravity;
+    std::vector<float> m_life, m_invMaxLife; // Remaining seconds, 1 / starting life
+    std::vector<float> m_halfSize;
+    std::vector<sf::Color> m_color;
+
+    // Render Buffer (6 vertices per particle, two triangles)
+    sf::VertexArray m_vertices;
+
+    std::minstd_rand m_rng;
+
+    // Internal Helpers
+    float RandomRange(float min, float max);
+    void RemoveDead();
+};
@@ -32,4 +32,11 @@ private:
     std::map<std::string, sf::Texture> m_textures;
     std::map<std::string, sf::SoundBuffer> m_sounds;
     std::map<std::string, sf::Font> m_fonts;
+
+    // --- Decoded Audio Cache ---
+    // Compressed sounds (mp3/ogg) are decoded to raw 16-bit PCM once and written
+    // next to the source as "<file>.pcm". Later launches load the samples directly
+    // instead of running the decoder on the main thread.
+    bool LoadPcmCache(const std::string& cachePath, const std::string& sourcePath, sf::SoundBuffer& buffer) const;
+    void SavePcmCache(const std::string& cachePath, const sf::SoundBuffer& buffer) const;
 };
\ No newline at end of file
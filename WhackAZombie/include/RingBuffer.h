@@ -0,0 +1,56 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// ----------------------------------------------------------------
+// RingBuffer
+// Description: Fixed-capacity single-producer / single-consumer queue.
+// The producer (game thread) and consumer (a background thread) never take
+// a lock; each side only writes its own index. Capacity must be a power
+// of two so wrapping is a mask instead of a division.
+// ----------------------------------------------------------------
+template <typename T, std::size_t Capacity>
+class RingBuffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+public:
+    RingBuffer() : m_head(0), m_tail(0) {}
+
+    // Producer side. Returns false (and drops the item) when the buffer is full.
+    bool Push(const T& item) {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        m_items[head & (Capacity - 1)] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Copies up to maxCount items into out and returns how many.
+    std::size_t Pop(T* out, std::size_t maxCount) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        std::size_t available = m_head.load(std::memory_order_acquire) - tail;
+        std::size_t count = available < maxCount ? available : maxCount;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = m_items[(tail + i) & (Capacity - 1)];
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t Size() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t GetCapacity() { return Capacity; }
+
+private:
+    std::array<T, Capacity> m_items;
+
+    // Kept on separate cache lines so producer and consumer don't false-share
+    alignas(64) std::atomic<std::size_t> m_head; // Next slot to write (producer)
+    alignas(64) std::atomic<std::size_t> m_tail; // Next slot to read (consumer)
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "GameSession.h"
+#include "RingBuffer.h"
+#include "ThreadPool.h"
+
+// A click sent by a remote client, in world coordinates
+struct ClickCommand {
+    int x;
+    int y;
+};
+
+// ----------------------------------------------------------------
+// SessionHost
+// Description: Runs many independent headless GameSessions in one process.
+// Each session has its own click inbox (a lock-free ring buffer fed by the
+// client-facing thread) and all sessions are stepped as one batch split
+// across a ThreadPool.
+//
+// Threading rules:
+//   - CreateSession() and Step() are called from the host thread only.
+//   - SubmitClick() is called from ONE feeder thread (pipe/socket reader).
+//   - Create all sessions before the feeder starts submitting.
+// ----------------------------------------------------------------
+class SessionHost {
+public:
+    // Clicks a single session can have queued between two steps
+    static const std::size_t INBOX_CAPACITY = 64;
+
+    explicit SessionHost(std::size_t threadCount);
+    ~SessionHost() = default;
+
+    // Returns the new session's id
+    std::size_t CreateSession(unsigned int seed);
+
+    // Queues a click. Returns false if the id is unknown or the inbox is full.
+    bool SubmitClick(std::size_t sessionId, int x, int y);
+
+    // Advances every session by deltaTime: drain clicks, then update.
+    void Step(float deltaTime);
+
+    std::size_t GetSessionCount() const { return m_sessions.size(); }
+    std::size_t GetThreadCount() const { return m_pool.GetThreadCount(); }
+
+    // Only safe to read between Step() calls
+    const GameSession& GetSession(std::size_t sessionId) const { return m_sessions[sessionId]->session; }
+
+private:
+    struct HostedSession {
+        explicit HostedSession(unsigned int seed) : session(nullptr, seed) {}
+
+        GameSession session;
+        RingBuffer<ClickCommand, INBOX_CAPACITY> inbox;
+    };
+
+    std::vector<std::unique_ptr<HostedSession>> m_sessions;
+    ThreadPool m_pool;
+
+    static void StepSession(HostedSession& hosted, float deltaTime);
+};
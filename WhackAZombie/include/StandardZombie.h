@@ -1,7 +1,10 @@
 #pragma once
 #include "Interface.h"
+#include "ZombieTuning.h"
+#include "ZombieAnimations.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <algorithm>
 
 // The Lifecycle of a Zombie
 enum class ZombieState {
@@ -9,41 +12,286 @@ enum class ZombieState {
     Spawning,   // Popping up (Animation)
     Active,     // Fully visible, waiting to be hit
     Hit,        // Struck by player (Death Animation)
-    Despawning  // Time ran out, retreating (Optional)
+    Despawning  // Time ran out, retreating
 };
 
-class StandardZombie : public IWhackable {
+// ----------------------------------------------------------------
+// BasicZombie<Tuning>
+// Description: One zombie kind, specialised at compile time by a tuning table
+// (see ZombieTuning.h). Implements the Whackable contract without virtuals,
+// so the ZombiePool can inline Update/TryHit into its per-kind loops.
+// Defined in the header so every caller sees the body.
+//
+// Visuals are driven by baked AnimationClips: the zombie only remembers
+// which clip is playing and for how long, and the pose (scale, offset,
+// color, frame) is looked up when it is needed.
+// ----------------------------------------------------------------
+template <typename Tuning>
+class BasicZombie {
 public:
+    using TuningType = Tuning;
+
     // Constructor: Requires the texture (skin) and the fixed position on screen.
-    StandardZombie(const sf::Texture& texture, sf::Vector2f position);
-    ~StandardZombie() = default;
+    // A null texture makes a headless zombie with a TARGET_SIZE square hitbox.
+    BasicZombie(const sf::Texture* texture, sf::Vector2f position);
+    ~BasicZombie() = default;
 
-    // --- IWhackable Contract Implementation ---
-    bool Update(float deltaTime) override;
-    void Render(sf::RenderWindow& window) override;
-    bool TryHit(int x, int y) override;
-    bool IsActive() const override;
-    sf::Vector2f GetPosition() const override;
+    // --- Whackable Contract ---
+    bool Update(float deltaTime);
+    void Render(sf::RenderWindow& window) const;
+    HitResult TryHit(int x, int y);
+    bool IsActive() const;
+    sf::Vector2f GetPosition() const;
+    float GetReactionTime() const { return m_reactionTimer; }
 
     // --- Command Methods ---
-    // Called by the Manager to wake the zombie up
-    void Spawn();
+    // Called by the Manager to wake the zombie up.
+    // lifetimeScale stretches/shrinks how long it stays up (Difficulty). Shrinking
+    // stops at reactionFloor (the player's reaction time), and that floor is itself
+    // capped at LIFETIME; a scale above 1 still stretches past LIFETIME.
+    void Spawn(float lifetimeScale = 1.0f, float reactionFloor = 0.0f);
     
     // Called to force the zombie back to the grave (reset)
     void Reset();
 
+    // The clip set shared by every zombie of this kind (baked on first use)
+    static const ZombieAnimations& Animations();
+
 private:
-    sf::Sprite m_sprite;
+    sf::Sprite m_sprite; // Color/frame follow the pose (synced in UpdateAnimation)
+    int m_shownFrame;
     ZombieState m_state;
     float m_maxScale;
+    int m_hitPoints;
     
     // Timers
     float m_stateTimer;      // Tracks how long we've been in the current state
     float m_activeDuration;  // How long the zombie stays up (Difficulty)
+    float m_reactionTimer;   // Time since it last became hittable (Active, or armour absorbed a hit)
+
+    // Animation
+    const AnimationClip* m_clip; // What is playing
+    float m_clipTimer;           // How long it has been playing
 
     // Visual Settings
     sf::Vector2f m_basePosition;
+    sf::Vector2f m_frameSize;
     
     // Internal Helpers
+    void EnterState(ZombieState state, const AnimationClip& clip);
+    void PlayClip(const AnimationClip& clip);
     void UpdateAnimation(float deltaTime);
-};
\ No newline at end of file
+    void SyncSprite(); // Applies the current pose's color and frame to the sprite
+    sf::FloatRect GetHitBox() const;
+};
+
+// The roster of kinds the game ships with
+using StandardZombie = BasicZombie<StandardTuning>;
+using FastZombie = BasicZombie<FastTuning>;
+using ArmoredZombie = BasicZombie<ArmoredTuning>;
+
+// ----------------------------------------------------------------
+// Implementation
+// ----------------------------------------------------------------
+
+template <typename Tuning>
+const ZombieAnimations& BasicZombie<Tuning>::Animations() {
+    static const ZombieAnimations clips = ZombieAnimations::Build(
+        Tuning::SPAWN_ANIMATION_TIME, Tuning::HIT_ANIMATION_TIME, Tuning::DESPAWN_ANIMATION_TIME,
+        sf::Color(Tuning::TINT), Tuning::SHEET_FRAMES);
+    return clips;
+}
+
+template <typename Tuning>
+BasicZombie<Tuning>::BasicZombie(const sf::Texture* texture, sf::Vector2f position)
+    : m_shownFrame(0), m_state(ZombieState::Hidden), m_maxScale(1.0f), m_hitPoints(Tuning::HIT_POINTS),
+      m_stateTimer(0.0f), m_activeDuration(Tuning::LIFETIME), m_reactionTimer(0.0f),
+      m_clip(&Animations().spawn), m_clipTimer(0.0f), m_basePosition(position)
+{
+    // Setup the sprite (the first frame of the sheet)
+    if (texture) {
+        m_sprite.setTexture(*texture);
+        sf::Vector2u textureSize = texture->getSize();
+        int frameWidth = static_cast<int>(textureSize.x) / Tuning::SHEET_FRAMES;
+        m_sprite.setTextureRect(sf::IntRect(0, 0, frameWidth, static_cast<int>(textureSize.y)));
+    } else {
+        // No texture: the rect alone defines the bounds (pure math, no GPU needed)
+        int size = static_cast<int>(Tuning::TARGET_SIZE);
+        m_sprite.setTextureRect(sf::IntRect(0, 0, size, size));
+    }
+    
+    // Center the origin so it scales from the middle, not the top-left.
+    // The sprite itself stays at (0, 0); Render() places it with the pose transform.
+    sf::FloatRect bounds = m_sprite.getLocalBounds();
+    m_frameSize = sf::Vector2f(bounds.width, bounds.height);
+    m_sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+    
+    // Calculate how much we need to shrink/grow the image to fit TARGET_SIZE
+    float scaleX = Tuning::TARGET_SIZE / bounds.width;
+    float scaleY = Tuning::TARGET_SIZE / bounds.height;
+    m_maxScale = std::min(scaleX, scaleY); // Keep aspect ratio
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::Spawn(float lifetimeScale, float reactionFloor) {
+    if (m_state == ZombieState::Hidden) {
+        EnterState(ZombieState::Spawning, Animations().spawn);
+
+        // Reaction times are measured over the Active phase, the same span
+        // LIFETIME covers, so the floor compares directly (capped per kind)
+        float activeFloor = std::min(Tuning::LIFETIME, reactionFloor);
+        m_activeDuration = std::max(Tuning::LIFETIME * lifetimeScale, activeFloor);
+        m_hitPoints = Tuning::HIT_POINTS;
+    }
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::Reset() {
+    m_state = ZombieState::Hidden;
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::EnterState(ZombieState state, const AnimationClip& clip) {
+    m_state = state;
+    m_stateTimer = 0.0f;
+    PlayClip(clip);
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::PlayClip(const AnimationClip& clip) {
+    m_clip = &clip;
+    m_clipTimer = 0.0f;
+    SyncSprite();
+}
+
+template <typename Tuning>
+bool BasicZombie<Tuning>::Update(float deltaTime) {
+    // Hidden zombies are the common case: bail out before touching anything else
+    if (m_state == ZombieState::Hidden) return false;
+
+    m_stateTimer += deltaTime;
+    m_reactionTimer += deltaTime;
+    UpdateAnimation(deltaTime);
+
+    switch (m_state) {
+        case ZombieState::Spawning:
+            // Pop-up finished: stand and wait
+            if (m_stateTimer >= Tuning::SPAWN_ANIMATION_TIME) {
+                EnterState(ZombieState::Active, Animations().idle);
+                m_reactionTimer = 0.0f; // Hittable from now on
+            }
+            return false;
+
+        case ZombieState::Active:
+            // Wait for player to hit. If time runs out, retreat.
+            if (m_stateTimer >= m_activeDuration) {
+                EnterState(ZombieState::Despawning, Animations().despawn);
+                return true; // Missed! It escaped.
+            }
+            return false;
+
+        case ZombieState::Hit:
+            // Death animation done, hide.
+            if (m_stateTimer >= Tuning::HIT_ANIMATION_TIME) {
+                Reset();
+            }
+            return false;
+
+        case ZombieState::Despawning:
+            // Back in the grave
+            if (m_stateTimer >= Tuning::DESPAWN_ANIMATION_TIME) {
+                Reset();
+            }
+            return false;
+
+        default:
+            return false;
+    }
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::UpdateAnimation(float deltaTime) {
+    m_clipTimer += deltaTime;
+
+    // One-shot overlays (the armour flash) hand back to the idle loop
+    if (m_state == ZombieState::Active && m_clip->IsFinished(m_clipTimer)) {
+        PlayClip(Animations().idle);
+    }
+
+    SyncSprite();
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::SyncSprite() {
+    const AnimationPose& pose = m_clip->Sample(m_clipTimer);
+
+    // Vertex data only changes when the pose actually asks for something new
+    if (m_sprite.getColor() != pose.color) {
+        m_sprite.setColor(pose.color);
+    }
+    if (pose.frame != m_shownFrame) {
+        int frameWidth = static_cast<int>(m_frameSize.x);
+        m_sprite.setTextureRect(sf::IntRect(pose.frame * frameWidth, 0, frameWidth, static_cast<int>(m_frameSize.y)));
+        m_shownFrame = pose.frame;
+    }
+}
+
+template <typename Tuning>
+void BasicZombie<Tuning>::Render(sf::RenderWindow& window) const {
+    if (m_state == ZombieState::Hidden) return;
+
+    // Color and frame are already synced (SyncSprite); only the transform is built here
+    const AnimationPose& pose = m_clip->Sample(m_clipTimer);
+
+    sf::RenderStates states;
+    states.transform.translate(m_basePosition + pose.offset);
+    states.transform.scale(m_maxScale * pose.scale.x, m_maxScale * pose.scale.y);
+    window.draw(m_sprite, states);
+}
+
+template <typename Tuning>
+sf::FloatRect BasicZombie<Tuning>::GetHitBox() const {
+    const AnimationPose& pose = m_clip->Sample(m_clipTimer);
+    sf::Vector2f size(m_frameSize.x * m_maxScale * pose.scale.x, m_frameSize.y * m_maxScale * pose.scale.y);
+    sf::Vector2f center = m_basePosition + pose.offset;
+    return sf::FloatRect(center.x - size.x / 2.0f, center.y - size.y / 2.0f, size.x, size.y);
+}
+
+template <typename Tuning>
+HitResult BasicZombie<Tuning>::TryHit(int x, int y) {
+    // Only allow hits if the zombie is fully active
+    if (m_state != ZombieState::Active) return HitResult::None;
+
+    // Hitbox follows the current pose (same box the player sees)
+    if (!GetHitBox().contains(static_cast<float>(x), static_cast<float>(y))) {
+        return HitResult::None;
+    }
+
+    // SUCCESS!
+    m_hitPoints--;
+
+    if constexpr (Tuning::HIT_POINTS > 1) {
+        if (m_hitPoints > 0) {
+            // Armour absorbed it: flash and keep standing, lifetime restarts.
+            // So does the reaction clock: the kill is timed from this blow.
+            m_stateTimer = 0.0f;
+            m_reactionTimer = 0.0f;
+            PlayClip(Animations().armorHit);
+            return HitResult::Absorbed;
+        }
+    }
+
+    // Visual Feedback: the hit clip turns it red, squashes, and shrinks it away
+    EnterState(ZombieState::Hit, Animations().hit);
+    return HitResult::Killed;
+}
+
+template <typename Tuning>
+bool BasicZombie<Tuning>::IsActive() const {
+    return m_state != ZombieState::Hidden;
+}
+
+template <typename Tuning>
+sf::Vector2f BasicZombie<Tuning>::GetPosition() const {
+    return m_basePosition;
+}
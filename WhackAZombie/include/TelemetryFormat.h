@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// ----------------------------------------------------------------
+// Telemetry File Format (.wazt)
+// Description: Shared between the game (writer) and the TelemetryReader tool.
+// Deliberately free of SFML so the reader builds on its own.
+//
+// Layout:
+//   TelemetryFileHeader
+//   Block*   where each block is:
+//     uint32_t count
+//     float    time[count]           (seconds since session start)
+//     float    value[count]          (frame time or reaction time, seconds)
+//     uint16_t activeZombies[count]
+//     uint8_t  event[count]          (TelemetryEvent)
+//
+// Columns are stored separately so a reader can scan one field without
+// touching the others, and so similar values sit next to each other.
+// ----------------------------------------------------------------
+
+const char TELEMETRY_MAGIC[4] = { 'W', 'A', 'Z', 'T' };
+const std::uint32_t TELEMETRY_VERSION = 1;
+
+enum class TelemetryEvent : std::uint8_t {
+    Frame = 0,   // value = frame delta time
+    Hit = 1,     // value = reaction time (hittable -> hit)
+    Miss = 2,    // Click that hit nothing; value unused
+    Escape = 3   // Zombie timed out (passive miss); value unused
+};
+
+struct TelemetryFileHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t blockCapacity; // Maximum records per block
+    std::uint32_t reserved;
+};
+
+// One row, as recorded in memory. Transposed into columns when written.
+struct TelemetryRecord {
+    float time;
+    float value;
+    std::uint16_t activeZombies;
+    TelemetryEvent event;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RingBuffer.h"
+#include "TelemetryFormat.h"
+
+// ----------------------------------------------------------------
+// TelemetryRecorder
+// Description: Records a time series of the session (per-frame health and
+// per-click events) into a lock-free ring buffer. A background thread drains
+// the buffer and streams it to disk in the columnar .wazt format.
+// Recording costs one clock read and one buffer write on the game thread.
+// ----------------------------------------------------------------
+class TelemetryRecorder {
+public:
+    explicit TelemetryRecorder(const std::string& filePath);
+    ~TelemetryRecorder();
+
+    // Returns false if the output file could not be opened (recording is then a no-op)
+    bool IsOpen() const { return m_isOpen; }
+
+    // --- Game Thread API ---
+    void RecordFrame(float frameTime, int activeZombies);
+    void RecordHit(float reactionTime, int activeZombies);
+    void RecordMiss(int activeZombies);
+    void RecordEscape(int activeZombies);
+
+    // Records lost because the writer fell behind and the buffer was full
+    std::uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    // ~16k records: several seconds of headroom even at high frame rates
+    static const std::size_t BUFFER_CAPACITY = 16384;
+    static const std::size_t BLOCK_CAPACITY = 1024;
+
+    RingBuffer<TelemetryRecord, BUFFER_CAPACITY> m_buffer;
+    std::chrono::steady_clock::time_point m_sessionStart;
+    std::atomic<std::uint64_t> m_dropped;
+    bool m_isOpen;
+
+    // --- Writer Thread State ---
+    std::ofstream m_file;
+    std::thread m_writer;
+    std::atomic<bool> m_running;
+
+    // Scratch space reused for every block (no allocation while streaming)
+    std::vector<TelemetryRecord> m_drained;
+    std::vector<float> m_timeColumn;
+    std::vector<float> m_valueColumn;
+    std::vector<std::uint16_t> m_activeColumn;
+    std::vector<std::uint8_t> m_eventColumn;
+
+    // Internal Helpers
+    void Record(TelemetryEvent event, float value, int activeZombies);
+    void WriterLoop();
+    bool DrainBlock(); // Returns true if anything was written
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------
+// ThreadPool
+// Description: A fixed set of worker threads for data-parallel batches.
+// ParallelFor() splits [0, count) into one contiguous range per worker,
+// so each thread walks its own slice of memory, and blocks until every
+// range is finished.
+// ----------------------------------------------------------------
+class ThreadPool {
+public:
+    using RangeTask = std::function<void(std::size_t begin, std::size_t end)>;
+
+    explicit ThreadPool(std::size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void ParallelFor(std::size_t count, const RangeTask& task);
+
+    std::size_t GetThreadCount() const { return m_threadCount; }
+
+private:
+    const std::size_t m_threadCount;
+    std::vector<std::thread> m_workers;
+
+    // Batch hand-off (guarded by m_mutex)
+    std::mutex m_mutex;
+    std::condition_variable m_wakeWorkers;
+    std::condition_variable m_batchDone;
+    const RangeTask* m_task;
+    std::size_t m_count;
+    std::uint64_t m_generation; // Bumped once per batch
+    std::size_t m_pending;      // Workers still busy with the current batch
+    bool m_isStopping;
+
+    void WorkerLoop(std::size_t workerIndex);
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include "Animation.h"
+
+// ----------------------------------------------------------------
+// ZombieAnimations
+// Description: The clip set for one zombie kind, one clip per FSM state
+// (plus the armour flash). Built and baked once per kind at load.
+// ----------------------------------------------------------------
+struct ZombieAnimations {
+    AnimationClip spawn;    // Pop out of the grave
+    AnimationClip idle;     // Looping "breathing" while Active
+    AnimationClip armorHit; // Whacked, but armour held
+    AnimationClip hit;      // Whacked for good
+    AnimationClip despawn;  // Time ran out, sinking back
+
+    // Timings come from the kind's tuning table; tint is its base color.
+    // sheetFrames > 1 cycles the idle clip through a horizontal spritesheet.
+    static ZombieAnimations Build(float spawnTime, float hitTime, float despawnTime, sf::Color tint, int sheetFrames);
+};
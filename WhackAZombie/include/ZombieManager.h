@@ -2,12 +2,25 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
+#include <random>
 #include "Interface.h"
+#include "StandardZombie.h"
+#include "ZombiePool.h"
+
+// Every zombie kind in the game. Adding a kind = adding a tuning table and a line here.
+using ZombieRoster = ZombiePool<StandardZombie, FastZombie, ArmoredZombie>;
 
 class ZombieManager {
 public:
     // Dependency Injection: We need the AssetSupplier to get textures.
-    ZombieManager(IAssetSupplier* assetSupplier);
+    // Passing nullptr creates a headless manager (no textures, never rendered),
+    // which is what the multi-session server uses.
+    // Each manager owns its own random generator, so sessions on different
+    // threads never share state.
+    ZombieManager(IAssetSupplier* assetSupplier, unsigned int seed);
+
+    // Custom board: one grave per spawn point (used by the perf suite for large boards)
+    ZombieManager(IAssetSupplier* assetSupplier, unsigned int seed, const std::vector<sf::Vector2f>& spawnPoints);
     ~ZombieManager();
 
     // The Game Loop hooks
@@ -15,22 +28,50 @@ public:
     void Render(sf::RenderWindow& window);
 
     // Input Handling
-    // Returns true if a zombie was successfully hit.
-    bool HandleClick(int x, int y);
+    // Returns what the click did to the top-most zombie under it.
+    // On a kill, reactionTime (if given) receives the seconds since that zombie became hittable.
+    HitResult HandleClick(int x, int y, float* reactionTime = nullptr);
+
+    // Number of zombies currently out of their graves
+    int GetActiveCount() const;
+
+    const std::vector<sf::Vector2f>& GetSpawnPoints() const { return m_spawnPoints; }
+
+    // Difficulty knobs (1.0 = designed baseline). Applied from the next spawn on.
+    // reactionFloor: seconds of Active time no zombie is shortened below.
+    void SetDifficulty(float spawnIntervalScale, float lifetimeScale, float reactionFloor = 0.0f);
+
+    // Optional: told about spawns and hits so it can play effects (may be nullptr)
+    void SetEffectListener(IEffectListener* listener) { m_effectListener = listener; }
+
+    // Wakes a zombie at a random free grave (normally driven by Update's timer).
+    // If all tried graves are busy, the spawn is skipped.
+    void SpawnRandomZombie();
+
+    // Sends every zombie back to its grave
+    void HideAll();
 
 private:
     // The Workforce
-    std::vector<std::unique_ptr<IWhackable>> m_zombies;
+    // One contiguous array per kind; each array has one zombie per spawn point.
+    ZombieRoster m_zombies;
     
     // The Locations (The 6+ required spawn points)
     std::vector<sf::Vector2f> m_spawnPoints;
     sf::Sprite m_graveSprite;
+    bool m_isHeadless;
+    IEffectListener* m_effectListener;
     
     // Spawning Logic
     float m_spawnTimer;
     float m_nextSpawnTime;
+    float m_spawnIntervalScale;
+    float m_lifetimeScale;
+    float m_reactionFloor;
+    std::minstd_rand m_rng;
 
     // Internal Helper
-    void SpawnRandomZombie();
-    void InitializeSpawnPoints();
+    std::size_t PickZombieKind();
+    float RandomUnit(); // Uniform in [0, 1)
+    static std::vector<sf::Vector2f> DefaultSpawnPoints();
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------
+// ZombiePool
+// Description: Type-list entity container. Every kind in Kinds... gets its
+// own contiguous std::vector, and all iteration is expanded at compile time
+// (one tight loop per kind), so there is no per-entity virtual dispatch.
+// Polymorphism happens when the kind list is written, not at runtime.
+//
+// Every kind must appear only once in the list and satisfy the Whackable
+// contract described in Interface.h.
+// ----------------------------------------------------------------
+template <typename... Kinds>
+class ZombiePool {
+public:
+    static constexpr std::size_t KIND_COUNT = sizeof...(Kinds);
+
+    // Direct access to the array holding one kind
+    template <typename Kind>
+    std::vector<Kind>& Get() { return std::get<std::vector<Kind>>(m_storage); }
+
+    template <typename Kind>
+    const std::vector<Kind>& Get() const { return std::get<std::vector<Kind>>(m_storage); }
+
+    // Constructs one entity of EVERY kind with the same arguments.
+    // Used to give each slot (spawn point) one instance per kind.
+    template <typename... Args>
+    void EmplaceEachKind(const Args&... args) {
+        (Get<Kinds>().emplace_back(args...), ...);
+    }
+
+    void Reserve(std::size_t perKind) {
+        (Get<Kinds>().reserve(perKind), ...);
+    }
+
+    // Total number of entities across all kinds
+    std::size_t Size() const {
+        return (Get<Kinds>().size() + ... + 0);
+    }
+
+    // Calls fn(entity) for every entity, one kind after another
+    template <typename Fn>
+    void ForEach(Fn&& fn) {
+        (ForEachIn(Get<Kinds>(), fn), ...);
+    }
+
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+        (ForEachIn(Get<Kinds>(), fn), ...);
+    }
+
+    // Walks everything back-to-front (last kind first) and stops at the
+    // first entity for which fn returns true. Returns whether one was found.
+    template <typename Fn>
+    bool FindReverse(Fn&& fn) {
+        return FindReverseImpl(fn, std::make_index_sequence<KIND_COUNT>{});
+    }
+
+    // Returns true if fn is true for the entity at 'slot' of any kind
+    template <typename Fn>
+    bool AnyInSlot(std::size_t slot, Fn&& fn) const {
+        return (fn(Get<Kinds>()[slot]) || ...);
+    }
+
+    // Calls fn on the entity at 'slot' of the kind at position 'kindIndex'
+    // in the type list. This is the one place a runtime value picks a kind.
+    template <typename Fn>
+    void VisitKind(std::size_t kindIndex, std::size_t slot, Fn&& fn) {
+        std::size_t current = 0;
+        ((current++ == kindIndex ? (fn(Get<Kinds>()[slot]), true) : false) || ...);
+    }
+
+private:
+    std::tuple<std::vector<Kinds>...> m_storage;
+
+    template <typename Array, typename Fn>
+    static void ForEachIn(Array& array, Fn& fn) {
+        for (auto& entity : array) {
+            fn(entity);
+        }
+    }
+
+    template <typename Array, typename Fn>
+    static bool FindReverseIn(Array& array, Fn& fn) {
+        for (auto it = array.rbegin(); it != array.rend(); ++it) {
+            if (fn(*it)) return true;
+        }
+        return false;
+    }
+
+    template <typename Fn, std::size_t... I>
+    bool FindReverseImpl(Fn& fn, std::index_sequence<I...>) {
+        return (FindReverseIn(std::get<KIND_COUNT - 1 - I>(m_storage), fn) || ...);
+    }
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/Config.hpp>
+
+// ----------------------------------------------------------------
+// Zombie Tuning Tables
+// Description: Compile-time "Game Feel" constants for each zombie kind.
+// Each struct is passed as a template parameter to BasicZombie, so the
+// constants are folded straight into that kind's update loop.
+//
+// Required members:
+//   SPAWN_ANIMATION_TIME, HIT_ANIMATION_TIME,
+//   DESPAWN_ANIMATION_TIME, LIFETIME                     (seconds)
+//   TARGET_SIZE   (on-screen size in pixels)
+//   HIT_POINTS    (whacks needed to put it down)
+//   TINT          (RGBA, multiplied with the texture)
+//   SPAWN_WEIGHT  (relative chance of being picked by the spawner)
+//   SHEET_FRAMES  (frames in the texture, laid out horizontally)
+// ----------------------------------------------------------------
+
+// The original zombie: one whack, stays up for 1.5s
+struct StandardTuning {
+    static constexpr float SPAWN_ANIMATION_TIME = 0.2f;
+    static constexpr float HIT_ANIMATION_TIME = 0.2f;
+    static constexpr float DESPAWN_ANIMATION_TIME = 0.25f;
+    static constexpr float LIFETIME = 1.5f;
+    static constexpr float TARGET_SIZE = 100.0f;
+    static constexpr int HIT_POINTS = 1;
+    static constexpr sf::Uint32 TINT = 0xFFFFFFFF;
+    static constexpr float SPAWN_WEIGHT = 6.0f;
+    static constexpr int SHEET_FRAMES = 1;
+};
+
+// Pops up quickly and ducks back before you can blink
+struct FastTuning {
+    static constexpr float SPAWN_ANIMATION_TIME = 0.1f;
+    static constexpr float HIT_ANIMATION_TIME = 0.15f;
+    static constexpr float DESPAWN_ANIMATION_TIME = 0.15f;
+    static constexpr float LIFETIME = 0.9f;
+    static constexpr float TARGET_SIZE = 85.0f;
+    static constexpr int HIT_POINTS = 1;
+    static constexpr sf::Uint32 TINT = 0xB0FFB0FF; // Sickly green
+    static constexpr float SPAWN_WEIGHT = 3.0f;
+    static constexpr int SHEET_FRAMES = 1;
+};
+
+// Slow and bulky, needs two whacks
+struct ArmoredTuning {
+    static constexpr float SPAWN_ANIMATION_TIME = 0.3f;
+    static constexpr float HIT_ANIMATION_TIME = 0.25f;
+    static constexpr float DESPAWN_ANIMATION_TIME = 0.35f;
+    static constexpr float LIFETIME = 2.2f;
+    static constexpr float TARGET_SIZE = 115.0f;
+    static constexpr int HIT_POINTS = 2;
+    static constexpr sf::Uint32 TINT = 0xA0B4FFFF; // Steel blue
+    static constexpr float SPAWN_WEIGHT = 1.0f;
+    static constexpr int SHEET_FRAMES = 1;
+};
@@ -0,0 +1,174 @@
+#include "../include/Animation.h"
+#include <algorithm>
+#include <cmath>
+
+const float PI = 3.14159265f;
+
+// ----------------------------------------------------------------
+// Easing Functions (only evaluated while building the tables)
+// ----------------------------------------------------------------
+
+static float EvaluateEasing(Easing easing, float t) {
+    switch (easing) {
+        case Easing::QuadIn:
+            return t * t;
+        case Easing::QuadOut:
+            return t * (2.0f - t);
+        case Easing::SineInOut:
+            return 0.5f - 0.5f * std::cos(PI * t);
+        case Easing::BackOut:
+            {
+                const float overshoot = 1.70158f;
+                float u = t - 1.0f;
+                return 1.0f + u * u * ((overshoot + 1.0f) * u + overshoot);
+            }
+        case Easing::BounceOut:
+            {
+                const float n = 7.5625f;
+                const float d = 2.75f;
+                if (t < 1.0f / d) return n * t * t;
+                if (t < 2.0f / d) { t -= 1.5f / d; return n * t * t + 0.75f; }
+                if (t < 2.5f / d) { t -= 2.25f / d; return n * t * t + 0.9375f; }
+                t -= 2.625f / d;
+                return n * t * t + 0.984375f;
+            }
+        case Easing::Linear:
+        default:
+            return t;
+    }
+}
+
+// ----------------------------------------------------------------
+// EasingTable
+// ----------------------------------------------------------------
+
+EasingTable::EasingTable() {
+    for (std::size_t curve = 0; curve < m_tables.size(); ++curve) {
+        for (std::size_t i = 0; i <= RESOLUTION; ++i) {
+            float t = static_cast<float>(i) / static_cast<float>(RESOLUTION);
+            m_tables[curve][i] = EvaluateEasing(static_cast<Easing>(curve), t);
+        }
+    }
+}
+
+const EasingTable& EasingTable::Get() {
+    static const EasingTable table;
+    return table;
+}
+
+float EasingTable::Sample(Easing easing, float t) const {
+    const auto& table = m_tables[static_cast<std::size_t>(easing)];
+    float position = std::clamp(t, 0.0f, 1.0f) * static_cast<float>(RESOLUTION);
+    std::size_t index = std::min(static_cast<std::size_t>(position), RESOLUTION - 1);
+    float fraction = position - static_cast<float>(index);
+    return table[index] + (table[index + 1] - table[index]) * fraction;
+}
+
+// ----------------------------------------------------------------
+// Track Evaluation (bake time only)
+// ----------------------------------------------------------------
+
+static sf::Vector2f Lerp(sf::Vector2f a, sf::Vector2f b, float t) {
+    return a + (b - a) * t;
+}
+
+static sf::Color Lerp(sf::Color a, sf::Color b, float t) {
+    auto channel = [t](sf::Uint8 from, sf::Uint8 to) {
+        float value = static_cast<float>(from) + (static_cast<float>(to) - static_cast<float>(from)) * t;
+        return static_cast<sf::Uint8>(std::clamp(value, 0.0f, 255.0f) + 0.5f);
+    };
+    return sf::Color(channel(a.r, b.r), channel(a.g, b.g), channel(a.b, b.b), channel(a.a, b.a));
+}
+
+static int Lerp(int a, int /*b*/, float /*t*/) {
+    return a; // Spritesheet frames step
+}
+
+template <typename T>
+T EvaluateTrack(const std::vector<Keyframe<T>>& keys, float time, const T& fallback) {
+    if (keys.empty()) return fallback;
+    if (time <= keys.front().time) return keys.front().value;
+    if (time >= keys.back().time) return keys.back().value;
+
+    // Keys are sorted; find the segment [previous, next] containing time
+    auto next = std::upper_bound(keys.begin(), keys.end(), time,
+        [](float t, const Keyframe<T>& key) { return t < key.time; });
+    auto previous = next - 1;
+
+    float span = next->time - previous->time;
+    float t = span > 0.0f ? (time - previous->time) / span : 1.0f;
+    return Lerp(previous->value, next->value, EasingTable::Get().Sample(next->easing, t));
+}
+
+template <typename T>
+void InsertKey(std::vector<Keyframe<T>>& keys, const Keyframe<T>& key) {
+    auto position = std::upper_bound(keys.begin(), keys.end(), key.time,
+        [](float t, const Keyframe<T>& existing) { return t < existing.time; });
+    keys.insert(position, key);
+}
+
+// ----------------------------------------------------------------
+// AnimationClip
+// ----------------------------------------------------------------
+
+AnimationClip::AnimationClip()
+    : m_duration(0.0f), m_isLooping(false)
+{
+}
+
+AnimationClip::AnimationClip(float duration, bool isLooping)
+    : m_duration(duration), m_isLooping(isLooping)
+{
+}
+
+AnimationClip& AnimationClip::AddScaleKey(float time, sf::Vector2f scale, Easing easing) {
+    InsertKey(m_scaleKeys, Keyframe<sf::Vector2f>{ time, scale, easing });
+    return *this;
+}
+
+AnimationClip& AnimationClip::AddOffsetKey(float time, sf::Vector2f offset, Easing easing) {
+    InsertKey(m_offsetKeys, Keyframe<sf::Vector2f>{ time, offset, easing });
+    return *this;
+}
+
+AnimationClip& AnimationClip::AddColorKey(float time, sf::Color color, Easing easing) {
+    InsertKey(m_colorKeys, Keyframe<sf::Color>{ time, color, easing });
+    return *this;
+}
+
+AnimationClip& AnimationClip::AddFrameKey(float time, int frame) {
+    InsertKey(m_frameKeys, Keyframe<int>{ time, frame, Easing::Linear });
+    return *this;
+}
+
+void AnimationClip::Bake() {
+    const AnimationPose rest;
+    std::size_t count = static_cast<std::size_t>(std::ceil(m_duration * BAKE_RATE)) + 1;
+
+    m_poses.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        float time = std::min(static_cast<float>(i) / BAKE_RATE, m_duration);
+        AnimationPose& pose = m_poses[i];
+        pose.scale = EvaluateTrack(m_scaleKeys, time, rest.scale);
+        pose.offset = EvaluateTrack(m_offsetKeys, time, rest.offset);
+        pose.color = EvaluateTrack(m_colorKeys, time, rest.color);
+        pose.frame = EvaluateTrack(m_frameKeys, time, rest.frame);
+    }
+
+    // The tracks live on only as the baked table
+    m_scaleKeys.clear();
+    m_offsetKeys.clear();
+    m_colorKeys.clear();
+    m_frameKeys.clear();
+}
+
+const AnimationPose& AnimationClip::Sample(float elapsed) const {
+    if (m_poses.empty()) return m_restPose;
+
+    if (m_isLooping && m_duration > 0.0f) {
+        elapsed = std::fmod(elapsed, m_duration);
+    }
+
+    std::size_t index = static_cast<std::size_t>(std::max(elapsed, 0.0f) * BAKE_RATE);
+    return m_poses[std::min(index, m_poses.size() - 1)];
+}
@@ -0,0 +1,68 @@
+#include "../include/AudioMixer.h"
+#include <algorithm>
+
+AudioMixer::AudioMixer()
+    : m_playCounter(0), m_isMuted(false), m_rng(std::random_device{}())
+{
+    m_startOrder.fill(0);
+}
+
+AudioMixer::~AudioMixer() {
+    // Stop the voices before they are destroyed so OpenAL releases them cleanly
+    StopAll();
+}
+
+void AudioMixer::Play(const sf::SoundBuffer& buffer, float volume, float pitchVariation, float volumeVariation) {
+    if (m_isMuted) return;
+
+    std::size_t index = AcquireVoice();
+    sf::Sound& voice = m_voices[index];
+
+    // Re-binding the buffer is only needed when the voice last played something else
+    if (voice.getBuffer() != &buffer) {
+        voice.setBuffer(buffer);
+    }
+
+    // Per-voice variation so repeated hits don't sound like a machine gun
+    voice.setPitch(1.0f + RandomRange(pitchVariation));
+    voice.setVolume(std::clamp(volume + RandomRange(volumeVariation), 0.0f, 100.0f));
+
+    m_startOrder[index] = ++m_playCounter;
+    voice.play();
+}
+
+void AudioMixer::SetMuted(bool muted) {
+    m_isMuted = muted;
+    if (m_isMuted) {
+        StopAll();
+    }
+}
+
+void AudioMixer::StopAll() {
+    for (auto& voice : m_voices) {
+        voice.stop();
+    }
+}
+
+std::size_t AudioMixer::AcquireVoice() {
+    // 1. Prefer a voice that has finished playing
+    // 2. Otherwise steal the one that started the longest time ago
+    std::size_t oldest = 0;
+    for (std::size_t i = 0; i < VOICE_COUNT; ++i) {
+        if (m_voices[i].getStatus() == sf::Sound::Stopped) {
+            return i;
+        }
+        if (m_startOrder[i] < m_startOrder[oldest]) {
+            oldest = i;
+        }
+    }
+
+    m_voices[oldest].stop();
+    return oldest;
+}
+
+float AudioMixer::RandomRange(float variation) {
+    if (variation <= 0.0f) return 0.0f;
+    // Uniform in [-variation, +variation]
+    return std::uniform_real_distribution<float>(-variation, variation)(m_rng);
+}
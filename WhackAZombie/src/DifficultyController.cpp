@@ -0,0 +1,74 @@
+#include "../include/DifficultyController.h"
+#include <algorithm>
+
+// Smoothing: each new event carries this much weight (~ the last 7 events matter)
+const float STATS_SMOOTHING = 0.15f;
+
+// Don't adapt until the averages mean something
+const int WARMUP_EVENTS = 5;
+
+// The accuracy band we steer the player into
+const float TARGET_HIT_RATE_LOW = 0.65f;
+const float TARGET_HIT_RATE_HIGH = 0.80f;
+
+// Difficulty change per second, per unit of hit-rate error
+const float ADJUST_RATE = 0.5f;
+
+// How far the knobs move at the extremes (difficulty = +/-1)
+const float SPAWN_INTERVAL_RANGE = 0.5f; // 0.5x .. 1.5x
+const float LIFETIME_RANGE = 0.4f;       // 0.6x .. 1.4x
+
+// Never shorten lifetimes below this multiple of the player's reaction time
+const float REACTION_MARGIN = 1.25f;
+
+DifficultyController::DifficultyController()
+    : m_hitRate(0.5f * (TARGET_HIT_RATE_LOW + TARGET_HIT_RATE_HIGH)),
+      m_reactionTime(0.0f), m_difficulty(0.0f), m_eventCount(0)
+{
+}
+
+void DifficultyController::OnHit(float reactionTime) {
+    m_hitRate += STATS_SMOOTHING * (1.0f - m_hitRate);
+
+    // First sample seeds the average instead of dragging it up from zero
+    if (m_reactionTime <= 0.0f) {
+        m_reactionTime = reactionTime;
+    } else {
+        m_reactionTime += STATS_SMOOTHING * (reactionTime - m_reactionTime);
+    }
+
+    if (m_eventCount < WARMUP_EVENTS) m_eventCount++;
+}
+
+void DifficultyController::OnMiss() {
+    m_hitRate += STATS_SMOOTHING * (0.0f - m_hitRate);
+    if (m_eventCount < WARMUP_EVENTS) m_eventCount++;
+}
+
+void DifficultyController::Update(float deltaTime) {
+    if (m_eventCount < WARMUP_EVENTS) return;
+
+    // Proportional control: only push when outside the band
+    float error = 0.0f;
+    if (m_hitRate > TARGET_HIT_RATE_HIGH) {
+        error = m_hitRate - TARGET_HIT_RATE_HIGH; // Too easy
+    } else if (m_hitRate < TARGET_HIT_RATE_LOW) {
+        error = m_hitRate - TARGET_HIT_RATE_LOW;  // Too hard (negative)
+    }
+
+    m_difficulty = std::clamp(m_difficulty + error * ADJUST_RATE * deltaTime, -1.0f, 1.0f);
+}
+
+float DifficultyController::GetSpawnIntervalScale() const {
+    return 1.0f - SPAWN_INTERVAL_RANGE * m_difficulty;
+}
+
+float DifficultyController::GetLifetimeScale() const {
+    return 1.0f - LIFETIME_RANGE * m_difficulty;
+}
+
+float DifficultyController::GetReactionFloor() const {
+    // Same clock as the reaction samples (Active time); each kind caps it at
+    // its own LIFETIME when it applies the floor (see BasicZombie::Spawn).
+    return REACTION_MARGIN * m_reactionTime;
+}
@@ -1,15 +1,23 @@
 #include "../include/GameEngine.h"
 #include "../include/ResourceManager.h"
-#include "../include/ZombieManager.h"
+#include "../include/GameSession.h"
 #include "../include/HUD.h"
+#include "../include/AudioMixer.h"
+#include "../include/TelemetryRecorder.h"
+#include "../include/ParticleSystem.h"
 #include <iostream>
+#include <ctime>
 
 // Screen Dimensions
 const int SCREEN_WIDTH = 800;
 const int SCREEN_HEIGHT = 600;
 
+// Hit Sound Variation (+/- around the base value)
+const float HIT_PITCH_VARIATION = 0.1f;
+const float HIT_VOLUME_VARIATION = 10.0f;
+
 GameEngine::GameEngine() 
-    : m_isRunning(true), m_score(0), m_misses(0), m_isMuted(false)
+    : m_isRunning(true), m_hitBuffer(nullptr), m_isMuted(false)
 {
     // 1. Setup Window
     m_window.create(sf::VideoMode(SCREEN_WIDTH, SCREEN_HEIGHT), "Whack-a-Zombie | Assignment 1");
@@ -25,11 +33,13 @@ GameEngine::GameEngine()
     m_resourceManager->LoadFont("game_font", "arial.ttf");
 
     // --- LOAD AUDIO ---
-    // Load the short sound into the manager
+    // Load the short sound into the manager (decoded to PCM once, then cached)
     m_resourceManager->LoadSound("hit", "hit.mp3"); 
     
-    // Setup the Hit Sound Player
-    m_hitSound.setBuffer(m_resourceManager->GetSound("hit"));
+    // Setup the Hit Sound Mixer
+    // Resolve the buffer now so OnHit() never does a map lookup
+    m_audioMixer = std::make_unique<AudioMixer>();
+    m_hitBuffer = &m_resourceManager->GetSound("hit");
     
     // Setup the Background Music (Stream directly)
     if (!m_backgroundMusic.openFromFile("assets/sounds/music.mp3")) {
@@ -55,9 +65,16 @@ GameEngine::GameEngine()
     // Apply the scale
     m_backgroundSprite.setScale(scaleX, scaleY);
 
-    // 5. Initialize Managers
-    m_zombieManager = std::make_unique<ZombieManager>(m_resourceManager.get());
-    m_hud = std::make_unique<HUD>(this, m_resourceManager.get());
+    // 5. Initialize the Session and HUD
+    m_session = std::make_unique<GameSession>(m_resourceManager.get(), static_cast<unsigned int>(std::time(nullptr)));
+    m_hud = std::make_unique<HUD>(m_session.get(), m_resourceManager.get());
+
+    // The session announces spawns and hits; the particle system turns them into effects
+    m_particles = std::make_unique<ParticleSystem>();
+    m_session->SetEffectListener(m_particles.get());
+
+    // 6. Start Session Recording (one file per launch, read with TelemetryReader)
+    m_telemetryRecorder = std::make_unique<TelemetryRecorder>("session_" + std::to_string(std::time(nullptr)) + ".wazt");
 }
 
 GameEngine::~GameEngine() {
@@ -89,6 +106,7 @@ void GameEngine::ProcessEvents() {
         if (event.type == sf::Event::KeyPressed) {
             if (event.key.code == sf::Keyboard::M) {
                 m_isMuted = !m_isMuted; // Toggle state
+                m_audioMixer->SetMuted(m_isMuted);
                 
                 if (m_isMuted) {
                     m_backgroundMusic.pause();
@@ -111,13 +129,15 @@ void GameEngine::ProcessEvents() {
                 int mouseX = static_cast<int>(worldPos.x);
                 int mouseY = static_cast<int>(worldPos.y);
 
-                // Pass the translated coordinates to the Zombie Manager
-                bool hit = m_zombieManager->HandleClick(mouseX, mouseY);
+                // Pass the translated coordinates to the Session (it keeps the score)
+                // An armour-absorbed hit only flashes the zombie; it is not scored or recorded.
+                float reactionTime = 0.0f;
+                HitResult result = m_session->HandleClick(mouseX, mouseY, &reactionTime);
                 
-                if (hit) {
-                    RegisterHit();
-                } else {
-                    RegisterMiss();
+                if (result == HitResult::Killed) {
+                    OnHit(reactionTime);
+                } else if (result == HitResult::None) {
+                    OnMiss();
                 }
             }
         }
@@ -125,11 +145,17 @@ void GameEngine::ProcessEvents() {
 }
 
 void GameEngine::Update(float deltaTime) {
-    // Get the number of passive misses from the manager
-    int passiveMisses = m_zombieManager->Update(deltaTime);
-    
-    // Add to the total
-    m_misses += passiveMisses;
+    // Step the simulation (passive misses are added to the session's total)
+    int passiveMisses = m_session->Update(deltaTime);
+
+    // Record frame health (and any zombies that escaped this frame)
+    int activeZombies = m_session->GetActiveCount();
+    for (int i = 0; i < passiveMisses; ++i) {
+        m_telemetryRecorder->RecordEscape(activeZombies);
+    }
+    m_telemetryRecorder->RecordFrame(deltaTime, activeZombies);
+
+    m_particles->Update(deltaTime);
 
     m_hud->Update();
 }
@@ -139,7 +165,10 @@ void GameEngine::Render() {
     m_window.draw(m_backgroundSprite);
 
     // Draw Zombies
-    m_zombieManager->Render(m_window);
+    m_session->Render(m_window);
+
+    // Draw Particles (on top of zombies, one draw call)
+    m_particles->Render(m_window);
 
     // Draw HUD (Always on top)
     m_hud->Render(m_window);
@@ -147,25 +176,19 @@ void GameEngine::Render() {
     m_window.display();
 }
 
-// --- ITelemetry Implementation ---
+// --- Click Feedback ---
 
-float GameEngine::GetAccuracy() const {
-    int totalShots = m_score + m_misses;
-    if (totalShots == 0) return 0.0f; // Prevent division by zero
-    return (static_cast<float>(m_score) / totalShots) * 100.0f;
-}
+void GameEngine::OnHit(float reactionTime) {
+    m_telemetryRecorder->RecordHit(reactionTime, m_session->GetActiveCount());
 
-void GameEngine::RegisterHit() {
-    m_score++;
     // Play the sound (if not muted)
     if (!m_isMuted) {
-        // Randomize pitch slightly for variety
-        // m_hitSound.setPitch(0.9f + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / 0.2f)));
-        
-        m_hitSound.play();
+        // Randomize pitch and volume slightly for variety.
+        // Each hit gets its own voice, so rapid hits overlap instead of cutting off.
+        m_audioMixer->Play(*m_hitBuffer, 100.0f, HIT_PITCH_VARIATION, HIT_VOLUME_VARIATION);
     }
 }
 
-void GameEngine::RegisterMiss() {
-    m_misses++;
+void GameEngine::OnMiss() {
+    m_telemetryRecorder->RecordMiss(m_session->GetActiveCount());
 }
\ No newline at end of file
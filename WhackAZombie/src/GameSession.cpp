@@ -0,0 +1,58 @@
+#include "../include/GameSession.h"
+
+GameSession::GameSession(IAssetSupplier* assetSupplier, unsigned int seed)
+    : m_zombieManager(assetSupplier, seed), m_score(0), m_misses(0)
+{
+}
+
+int GameSession::Update(float deltaTime) {
+    // Get the number of passive misses from the manager
+    int passiveMisses = m_zombieManager.Update(deltaTime);
+
+    // Add to the total
+    m_misses += passiveMisses;
+    for (int i = 0; i < passiveMisses; ++i) {
+        m_difficulty.OnMiss();
+    }
+
+    // Adapt to the player; the manager applies the knobs from its next spawn
+    m_difficulty.Update(deltaTime);
+    m_zombieManager.SetDifficulty(m_difficulty.GetSpawnIntervalScale(), m_difficulty.GetLifetimeScale(),
+                                  m_difficulty.GetReactionFloor());
+
+    return passiveMisses;
+}
+
+void GameSession::Render(sf::RenderWindow& window) {
+    m_zombieManager.Render(window);
+}
+
+HitResult GameSession::HandleClick(int x, int y, float* reactionTime) {
+    float reaction = 0.0f;
+    HitResult result = m_zombieManager.HandleClick(x, y, &reaction);
+
+    if (result == HitResult::Killed) {
+        RegisterHit(reaction);
+    } else if (result == HitResult::None) {
+        RegisterMiss();
+    }
+
+    if (reactionTime) *reactionTime = reaction;
+    return result;
+}
+
+float GameSession::GetAccuracy() const {
+    int totalShots = m_score + m_misses;
+    if (totalShots == 0) return 0.0f; // Prevent division by zero
+    return (static_cast<float>(m_score) / totalShots) * 100.0f;
+}
+
+void GameSession::RegisterHit(float reactionTime) {
+    m_score++;
+    m_difficulty.OnHit(reactionTime);
+}
+
+void GameSession::RegisterMiss() {
+    m_misses++;
+    m_difficulty.OnMiss();
+}
@@ -0,0 +1,191 @@
+#include "../include/ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+// Air resistance: fraction of velocity kept after one second
+const float DRAG_PER_SECOND = 0.2f;
+
+// ----------------------------------------------------------------
+// Presets
+// ----------------------------------------------------------------
+
+ParticleBurst ParticleBurst::Splatter() {
+    ParticleBurst burst;
+    burst.count = 48;
+    burst.speedMin = 120.0f;
+    burst.speedMax = 420.0f;
+    burst.direction = -1.5708f; // Up
+    burst.spread = 3.1416f;     // ... and every other way
+    burst.lifeMin = 0.35f;
+    burst.lifeMax = 0.8f;
+    burst.sizeMin = 2.0f;
+    burst.sizeMax = 5.0f;
+    burst.gravity = 900.0f;
+    burst.color = sf::Color(120, 190, 60); // Zombie blood is green
+    burst.colorVariation = 30;
+    return burst;
+}
+
+ParticleBurst ParticleBurst::Dust() {
+    ParticleBurst burst;
+    burst.count = 20;
+    burst.speedMin = 20.0f;
+    burst.speedMax = 80.0f;
+    burst.direction = -1.5708f; // Up
+    burst.spread = 1.2f;
+    burst.lifeMin = 0.4f;
+    burst.lifeMax = 0.9f;
+    burst.sizeMin = 3.0f;
+    burst.sizeMax = 7.0f;
+    burst.gravity = -30.0f;     // Drifts upward
+    burst.color = sf::Color(140, 115, 85, 200);
+    burst.colorVariation = 15;
+    return burst;
+}
+
+// ----------------------------------------------------------------
+// ParticleSystem
+// ----------------------------------------------------------------
+
+ParticleSystem::ParticleSystem(std::size_t capacity)
+    : m_capacity(capacity), m_liveCount(0), m_vertices(sf::Triangles), m_rng(std::random_device{}())
+{
+    // The only allocations the system ever makes
+    m_posX.resize(capacity);
+    m_posY.resize(capacity);
+    m_velX.resize(capacity);
+    m_velY.resize(capacity);
+    m_gravity.resize(capacity);
+    m_life.resize(capacity);
+    m_invMaxLife.resize(capacity);
+    m_halfSize.resize(capacity);
+    m_color.resize(capacity);
+
+    // Reserve the full vertex buffer, then shrink; later resizes stay within capacity
+    m_vertices.resize(capacity * 6);
+    m_vertices.clear();
+}
+
+float ParticleSystem::RandomRange(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(m_rng);
+}
+
+void ParticleSystem::Emit(sf::Vector2f position, const ParticleBurst& burst) {
+    std::size_t room = m_capacity - m_liveCount;
+    std::size_t count = std::min(static_cast<std::size_t>(std::max(burst.count, 0)), room);
+
+    std::uniform_int_distribution<int> shade(-burst.colorVariation, burst.colorVariation);
+    auto vary = [&](sf::Uint8 channel) {
+        return static_cast<sf::Uint8>(std::clamp(static_cast<int>(channel) + shade(m_rng), 0, 255));
+    };
+
+    for (std::size_t n = 0; n < count; ++n) {
+        std::size_t i = m_liveCount++;
+
+        float angle = burst.direction + RandomRange(-burst.spread, burst.spread);
+        float speed = RandomRange(burst.speedMin, burst.speedMax);
+        float life = RandomRange(burst.lifeMin, burst.lifeMax);
+
+        m_posX[i] = position.x;
+        m_posY[i] = position.y;
+        m_velX[i] = std::cos(angle) * speed;
+        m_velY[i] = std::sin(angle) * speed;
+        m_gravity[i] = burst.gravity;
+        m_life[i] = life;
+        m_invMaxLife[i] = 1.0f / life;
+        m_halfSize[i] = 0.5f * RandomRange(burst.sizeMin, burst.sizeMax);
+        m_color[i] = sf::Color(vary(burst.color.r), vary(burst.color.g), vary(burst.color.b), burst.color.a);
+    }
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    const std::size_t count = m_liveCount;
+    const float drag = std::pow(DRAG_PER_SECOND, deltaTime);
+
+    // Plain arrays + no branches: each loop vectorises
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    float* velX = m_velX.data();
+    float* velY = m_velY.data();
+    const float* gravity = m_gravity.data();
+    float* life = m_life.data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        velX[i] *= drag;
+        velY[i] = velY[i] * drag + gravity[i] * deltaTime;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        life[i] -= deltaTime;
+    }
+
+    RemoveDead();
+}
+
+void ParticleSystem::RemoveDead() {
+    // Swap-remove: move the last live particle into the hole
+    std::size_t i = 0;
+    while (i < m_liveCount) {
+        if (m_life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+
+        std::size_t last = --m_liveCount;
+        m_posX[i] = m_posX[last];
+        m_posY[i] = m_posY[last];
+        m_velX[i] = m_velX[last];
+        m_velY[i] = m_velY[last];
+        m_gravity[i] = m_gravity[last];
+        m_life[i] = m_life[last];
+        m_invMaxLife[i] = m_invMaxLife[last];
+        m_halfSize[i] = m_halfSize[last];
+        m_color[i] = m_color[last];
+    }
+}
+
+void ParticleSystem::Render(sf::RenderWindow& window) {
+    if (m_liveCount == 0) return;
+
+    m_vertices.resize(m_liveCount * 6);
+
+    for (std::size_t i = 0; i < m_liveCount; ++i) {
+        float x = m_posX[i];
+        float y = m_posY[i];
+        float h = m_halfSize[i];
+
+        // Fade out over the particle's life
+        sf::Color color = m_color[i];
+        color.a = static_cast<sf::Uint8>(static_cast<float>(color.a) * std::min(1.0f, m_life[i] * m_invMaxLife[i]));
+
+        sf::Vertex* quad = &m_vertices[i * 6];
+        quad[0].position = sf::Vector2f(x - h, y - h);
+        quad[1].position = sf::Vector2f(x + h, y - h);
+        quad[2].position = sf::Vector2f(x + h, y + h);
+        quad[3].position = sf::Vector2f(x - h, y - h);
+        quad[4].position = sf::Vector2f(x + h, y + h);
+        quad[5].position = sf::Vector2f(x - h, y + h);
+        for (int v = 0; v < 6; ++v) {
+            quad[v].color = color;
+        }
+    }
+
+    // One draw call for every particle
+    window.draw(m_vertices);
+}
+
+// ----------------------------------------------------------------
+// IEffectListener Implementation
+// ----------------------------------------------------------------
+
+void ParticleSystem::OnZombieSpawned(sf::Vector2f position) {
+    // Dirt kicked up at the foot of the grave
+    Emit(position + sf::Vector2f(0.0f, 35.0f), ParticleBurst::Dust());
+}
+
+void ParticleSystem::OnZombieHit(sf::Vector2f position) {
+    Emit(position, ParticleBurst::Splatter());
+}
@@ -1,5 +1,22 @@
 #include "../include/ResourceManager.h"
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <cstdint>
+#include <vector>
+
+// PCM cache file layout: header followed by interleaved 16-bit samples
+const char PCM_CACHE_MAGIC[4] = { 'W', 'A', 'Z', 'P' };
+const std::uint32_t PCM_CACHE_VERSION = 1;
+
+struct PcmCacheHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t sampleRate;
+    std::uint32_t channelCount;
+    std::uint64_t sampleCount;
+};
 
 ResourceManager::ResourceManager() {
     // Constructor
@@ -29,10 +46,16 @@ bool ResourceManager::LoadTexture(const std::string& name, const std::string& fi
 
 bool ResourceManager::LoadSound(const std::string& name, const std::string& filename) {
     sf::SoundBuffer buffer;
-
-    if (!buffer.loadFromFile("assets/sounds/" + filename)) {
-        std::cerr << "[ResourceManager] Error: Failed to load sound: " << filename << std::endl;
-        return false;
+    const std::string sourcePath = "assets/sounds/" + filename;
+    const std::string cachePath = sourcePath + ".pcm";
+
+    // Fast path: samples were already decoded on a previous launch
+    if (!LoadPcmCache(cachePath, sourcePath, buffer)) {
+        if (!buffer.loadFromFile(sourcePath)) {
+            std::cerr << "[ResourceManager] Error: Failed to load sound: " << filename << std::endl;
+            return false;
+        }
+        SavePcmCache(cachePath, buffer);
     }
 
     m_sounds[name] = buffer;
@@ -52,6 +75,67 @@ bool ResourceManager::LoadFont(const std::string& name, const std::string& filen
     return true;
 }
 
+// ----------------------------------------------------------------
+// PCM Cache
+// ----------------------------------------------------------------
+
+bool ResourceManager::LoadPcmCache(const std::string& cachePath, const std::string& sourcePath, sf::SoundBuffer& buffer) const {
+    std::error_code ec;
+    if (!std::filesystem::exists(cachePath, ec)) return false;
+
+    // Stale cache: the source asset was replaced after we decoded it
+    if (std::filesystem::exists(sourcePath, ec) &&
+        std::filesystem::last_write_time(cachePath, ec) < std::filesystem::last_write_time(sourcePath, ec)) {
+        return false;
+    }
+
+    std::ifstream file(cachePath, std::ios::binary);
+    PcmCacheHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+
+    if (!std::equal(header.magic, header.magic + 4, PCM_CACHE_MAGIC) ||
+        header.version != PCM_CACHE_VERSION || header.channelCount == 0 || header.sampleRate == 0 ||
+        header.sampleCount == 0 || header.sampleCount % header.channelCount != 0) {
+        return false;
+    }
+
+    // Truncated or corrupt file: the payload must hold exactly sampleCount samples.
+    // Checked before allocating, so a bad count can never size the vector.
+    std::uintmax_t fileSize = std::filesystem::file_size(cachePath, ec);
+    if (ec || fileSize < sizeof(header)) return false;
+
+    std::uintmax_t payloadSize = fileSize - sizeof(header);
+    if (payloadSize % sizeof(sf::Int16) != 0 || payloadSize / sizeof(sf::Int16) != header.sampleCount) {
+        return false;
+    }
+
+    std::vector<sf::Int16> samples(static_cast<std::size_t>(header.sampleCount));
+    if (!file.read(reinterpret_cast<char*>(samples.data()), static_cast<std::streamsize>(samples.size() * sizeof(sf::Int16)))) {
+        return false;
+    }
+
+    return buffer.loadFromSamples(samples.data(), header.sampleCount, header.channelCount, header.sampleRate);
+}
+
+void ResourceManager::SavePcmCache(const std::string& cachePath, const sf::SoundBuffer& buffer) const {
+    PcmCacheHeader header;
+    std::copy(PCM_CACHE_MAGIC, PCM_CACHE_MAGIC + 4, header.magic);
+    header.version = PCM_CACHE_VERSION;
+    header.sampleRate = buffer.getSampleRate();
+    header.channelCount = buffer.getChannelCount();
+    header.sampleCount = buffer.getSampleCount();
+
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        // Not fatal: we simply decode again next launch
+        std::cerr << "[ResourceManager] Warning: Could not write PCM cache: " << cachePath << std::endl;
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(buffer.getSamples()), static_cast<std::streamsize>(header.sampleCount * sizeof(sf::Int16)));
+}
+
 // ----------------------------------------------------------------
 // Retrieval Methods
 // ----------------------------------------------------------------
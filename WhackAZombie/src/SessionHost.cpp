@@ -0,0 +1,37 @@
+#include "../include/SessionHost.h"
+
+SessionHost::SessionHost(std::size_t threadCount)
+    : m_pool(threadCount)
+{
+}
+
+std::size_t SessionHost::CreateSession(unsigned int seed) {
+    m_sessions.push_back(std::make_unique<HostedSession>(seed));
+    return m_sessions.size() - 1;
+}
+
+bool SessionHost::SubmitClick(std::size_t sessionId, int x, int y) {
+    if (sessionId >= m_sessions.size()) return false;
+    return m_sessions[sessionId]->inbox.Push(ClickCommand{ x, y });
+}
+
+void SessionHost::Step(float deltaTime) {
+    m_pool.ParallelFor(m_sessions.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            StepSession(*m_sessions[i], deltaTime);
+        }
+    });
+}
+
+void SessionHost::StepSession(HostedSession& hosted, float deltaTime) {
+    // 1. Apply the clicks that arrived since the last step (same order as the
+    //    windowed game: input first, then update)
+    ClickCommand clicks[INBOX_CAPACITY];
+    std::size_t count = hosted.inbox.Pop(clicks, INBOX_CAPACITY);
+    for (std::size_t i = 0; i < count; ++i) {
+        hosted.session.HandleClick(clicks[i].x, clicks[i].y);
+    }
+
+    // 2. Advance the simulation
+    hosted.session.Update(deltaTime);
+}
@@ -0,0 +1,120 @@
+#include "../include/TelemetryRecorder.h"
+#include <algorithm>
+#include <iostream>
+
+// How often the writer thread wakes up to drain the buffer
+const int WRITER_INTERVAL_MS = 100;
+
+TelemetryRecorder::TelemetryRecorder(const std::string& filePath)
+    : m_sessionStart(std::chrono::steady_clock::now()), m_dropped(0), m_isOpen(false), m_running(false)
+{
+    m_file.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!m_file) {
+        std::cerr << "[TelemetryRecorder] Error: Could not open " << filePath << std::endl;
+        return;
+    }
+
+    TelemetryFileHeader header;
+    std::copy(TELEMETRY_MAGIC, TELEMETRY_MAGIC + 4, header.magic);
+    header.version = TELEMETRY_VERSION;
+    header.blockCapacity = static_cast<std::uint32_t>(BLOCK_CAPACITY);
+    header.reserved = 0;
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    m_drained.resize(BLOCK_CAPACITY);
+    m_timeColumn.resize(BLOCK_CAPACITY);
+    m_valueColumn.resize(BLOCK_CAPACITY);
+    m_activeColumn.resize(BLOCK_CAPACITY);
+    m_eventColumn.resize(BLOCK_CAPACITY);
+
+    m_isOpen = true;
+    m_running = true;
+    m_writer = std::thread(&TelemetryRecorder::WriterLoop, this);
+    std::cout << "[TelemetryRecorder] Recording to " << filePath << std::endl;
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    if (m_writer.joinable()) {
+        m_running = false;
+        m_writer.join();
+    }
+
+    // The writer has stopped, so this thread is now the only consumer
+    if (m_isOpen) {
+        while (DrainBlock()) {}
+    }
+
+    if (m_dropped > 0) {
+        std::cerr << "[TelemetryRecorder] Warning: Dropped " << m_dropped << " records" << std::endl;
+    }
+}
+
+// ----------------------------------------------------------------
+// Game Thread API
+// ----------------------------------------------------------------
+
+void TelemetryRecorder::RecordFrame(float frameTime, int activeZombies) {
+    Record(TelemetryEvent::Frame, frameTime, activeZombies);
+}
+
+void TelemetryRecorder::RecordHit(float reactionTime, int activeZombies) {
+    Record(TelemetryEvent::Hit, reactionTime, activeZombies);
+}
+
+void TelemetryRecorder::RecordMiss(int activeZombies) {
+    Record(TelemetryEvent::Miss, 0.0f, activeZombies);
+}
+
+void TelemetryRecorder::RecordEscape(int activeZombies) {
+    Record(TelemetryEvent::Escape, 0.0f, activeZombies);
+}
+
+void TelemetryRecorder::Record(TelemetryEvent event, float value, int activeZombies) {
+    if (!m_isOpen) return;
+
+    std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - m_sessionStart;
+
+    TelemetryRecord record;
+    record.time = elapsed.count();
+    record.value = value;
+    record.activeZombies = static_cast<std::uint16_t>(std::clamp(activeZombies, 0, 0xFFFF));
+    record.event = event;
+
+    if (!m_buffer.Push(record)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// ----------------------------------------------------------------
+// Writer Thread
+// ----------------------------------------------------------------
+
+void TelemetryRecorder::WriterLoop() {
+    while (m_running) {
+        // Write everything that is queued, then sleep
+        while (DrainBlock()) {}
+        m_file.flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_INTERVAL_MS));
+    }
+}
+
+bool TelemetryRecorder::DrainBlock() {
+    std::size_t count = m_buffer.Pop(m_drained.data(), BLOCK_CAPACITY);
+    if (count == 0) return false;
+
+    // Transpose rows into columns
+    for (std::size_t i = 0; i < count; ++i) {
+        m_timeColumn[i] = m_drained[i].time;
+        m_valueColumn[i] = m_drained[i].value;
+        m_activeColumn[i] = m_drained[i].activeZombies;
+        m_eventColumn[i] = static_cast<std::uint8_t>(m_drained[i].event);
+    }
+
+    std::uint32_t blockCount = static_cast<std::uint32_t>(count);
+    m_file.write(reinterpret_cast<const char*>(&blockCount), sizeof(blockCount));
+    m_file.write(reinterpret_cast<const char*>(m_timeColumn.data()), static_cast<std::streamsize>(count * sizeof(float)));
+    m_file.write(reinterpret_cast<const char*>(m_valueColumn.data()), static_cast<std::streamsize>(count * sizeof(float)));
+    m_file.write(reinterpret_cast<const char*>(m_activeColumn.data()), static_cast<std::streamsize>(count * sizeof(std::uint16_t)));
+    m_file.write(reinterpret_cast<const char*>(m_eventColumn.data()), static_cast<std::streamsize>(count * sizeof(std::uint8_t)));
+    return true;
+}
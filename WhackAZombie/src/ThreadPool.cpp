@@ -0,0 +1,64 @@
+#include "../include/ThreadPool.h"
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : m_threadCount(threadCount > 0 ? threadCount : 1), m_task(nullptr), m_count(0),
+      m_generation(0), m_pending(0), m_isStopping(false)
+{
+    m_workers.reserve(m_threadCount);
+    for (std::size_t i = 0; i < m_threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeWorkers.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const RangeTask& task) {
+    if (count == 0) return;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_task = &task;
+    m_count = count;
+    m_pending = m_threadCount;
+    m_generation++;
+    m_wakeWorkers.notify_all();
+
+    m_batchDone.wait(lock, [this] { return m_pending == 0; });
+    m_task = nullptr;
+}
+
+void ThreadPool::WorkerLoop(std::size_t workerIndex) {
+    std::uint64_t seenGeneration = 0;
+
+    while (true) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeWorkers.wait(lock, [&] { return m_isStopping || m_generation != seenGeneration; });
+        if (m_isStopping) return;
+
+        seenGeneration = m_generation;
+        const RangeTask* task = m_task;
+        std::size_t count = m_count;
+        lock.unlock();
+
+        // This worker's contiguous slice of the batch
+        std::size_t begin = count * workerIndex / m_threadCount;
+        std::size_t end = count * (workerIndex + 1) / m_threadCount;
+        if (begin < end) {
+            (*task)(begin, end);
+        }
+
+        lock.lock();
+        if (--m_pending == 0) {
+            m_batchDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "../include/ZombieAnimations.h"
+
+// Idle "breathing" cycle length
+const float IDLE_CYCLE_TIME = 1.2f;
+const float ARMOR_FLASH_TIME = 0.2f;
+
+// How far a zombie rises out of / sinks into the grave (pixels)
+const float GRAVE_DEPTH = 30.0f;
+
+ZombieAnimations ZombieAnimations::Build(float spawnTime, float hitTime, float despawnTime, sf::Color tint, int sheetFrames) {
+    ZombieAnimations clips;
+    sf::Color transparentTint(tint.r, tint.g, tint.b, 0);
+
+    // --- Spawn: rise out of the grave, overshoot, settle ---
+    clips.spawn = AnimationClip(spawnTime, false);
+    clips.spawn
+        .AddScaleKey(0.0f, sf::Vector2f(0.0f, 0.0f))
+        .AddScaleKey(spawnTime * 0.75f, sf::Vector2f(1.1f, 1.1f), Easing::QuadOut)
+        .AddScaleKey(spawnTime, sf::Vector2f(1.0f, 1.0f), Easing::SineInOut)
+        .AddOffsetKey(0.0f, sf::Vector2f(0.0f, GRAVE_DEPTH))
+        .AddOffsetKey(spawnTime, sf::Vector2f(0.0f, 0.0f), Easing::QuadOut)
+        .AddColorKey(0.0f, tint);
+
+    // --- Idle: gentle squash and stretch ---
+    clips.idle = AnimationClip(IDLE_CYCLE_TIME, true);
+    clips.idle
+        .AddScaleKey(0.0f, sf::Vector2f(1.0f, 1.0f))
+        .AddScaleKey(IDLE_CYCLE_TIME * 0.5f, sf::Vector2f(1.03f, 0.97f), Easing::SineInOut)
+        .AddScaleKey(IDLE_CYCLE_TIME, sf::Vector2f(1.0f, 1.0f), Easing::SineInOut)
+        .AddColorKey(0.0f, tint);
+    for (int frame = 0; frame < sheetFrames; ++frame) {
+        clips.idle.AddFrameKey(IDLE_CYCLE_TIME * static_cast<float>(frame) / static_cast<float>(sheetFrames), frame);
+    }
+
+    // --- Armour Hit: pink flash and a small bounce back ---
+    clips.armorHit = AnimationClip(ARMOR_FLASH_TIME, false);
+    clips.armorHit
+        .AddScaleKey(0.0f, sf::Vector2f(1.15f, 0.85f))
+        .AddScaleKey(ARMOR_FLASH_TIME, sf::Vector2f(1.0f, 1.0f), Easing::BackOut)
+        .AddColorKey(0.0f, sf::Color(255, 160, 160))
+        .AddColorKey(ARMOR_FLASH_TIME, tint, Easing::QuadIn);
+
+    // --- Hit: turn red, squash, then shrink away ---
+    clips.hit = AnimationClip(hitTime, false);
+    clips.hit
+        .AddScaleKey(0.0f, sf::Vector2f(1.2f, 0.8f))
+        .AddScaleKey(hitTime * 0.4f, sf::Vector2f(1.3f, 0.7f), Easing::QuadOut)
+        .AddScaleKey(hitTime, sf::Vector2f(0.2f, 0.2f), Easing::QuadIn)
+        .AddColorKey(0.0f, sf::Color::Red)
+        .AddColorKey(hitTime * 0.4f, sf::Color::Red)
+        .AddColorKey(hitTime, sf::Color(255, 0, 0, 0), Easing::QuadIn);
+
+    // --- Despawn: sink back into the grave and fade ---
+    clips.despawn = AnimationClip(despawnTime, false);
+    clips.despawn
+        .AddScaleKey(0.0f, sf::Vector2f(1.0f, 1.0f))
+        .AddScaleKey(despawnTime, sf::Vector2f(0.6f, 0.0f), Easing::QuadIn)
+        .AddOffsetKey(0.0f, sf::Vector2f(0.0f, 0.0f))
+        .AddOffsetKey(despawnTime, sf::Vector2f(0.0f, GRAVE_DEPTH), Easing::QuadIn)
+        .AddColorKey(0.0f, tint)
+        .AddColorKey(despawnTime, transparentTint, Easing::QuadIn);
+
+    clips.spawn.Bake();
+    clips.idle.Bake();
+    clips.armorHit.Bake();
+    clips.hit.Bake();
+    clips.despawn.Bake();
+    return clips;
+}
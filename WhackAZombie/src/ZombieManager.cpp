@@ -1,21 +1,44 @@
 #include "../include/ZombieManager.h"
-#include "../include/StandardZombie.h"
 #include <iostream>
-#include <cstdlib> // For rand()
-#include <ctime>   // For time()
 
 // Configuration
 const int MAX_ZOMBIES = 6; // One for each spawn point
 const float MIN_SPAWN_TIME = 0.5f;
 const float MAX_SPAWN_TIME = 1.5f;
 
-ZombieManager::ZombieManager(IAssetSupplier* assetSupplier) 
-    : m_spawnTimer(0.0f), m_nextSpawnTime(1.0f)
+// Weighted pick over the roster using each kind's SPAWN_WEIGHT
+// 'unit' is a uniform random number in [0, 1)
+template <typename... Kinds>
+std::size_t PickWeightedKind(const ZombiePool<Kinds...>&, float unit) {
+    static constexpr float weights[] = { Kinds::TuningType::SPAWN_WEIGHT... };
+    static constexpr float total = (Kinds::TuningType::SPAWN_WEIGHT + ...);
+
+    float roll = unit * total;
+    for (std::size_t i = 0; i < sizeof...(Kinds); ++i) {
+        if (roll < weights[i]) return i;
+        roll -= weights[i];
+    }
+    return sizeof...(Kinds) - 1;
+}
+
+ZombieManager::ZombieManager(IAssetSupplier* assetSupplier, unsigned int seed)
+    : ZombieManager(assetSupplier, seed, DefaultSpawnPoints())
+{
+}
+
+ZombieManager::ZombieManager(IAssetSupplier* assetSupplier, unsigned int seed, const std::vector<sf::Vector2f>& spawnPoints) 
+    : m_spawnPoints(spawnPoints), m_isHeadless(assetSupplier == nullptr), m_effectListener(nullptr),
+      m_spawnTimer(0.0f), m_nextSpawnTime(1.0f), m_spawnIntervalScale(1.0f), m_lifetimeScale(1.0f), m_reactionFloor(0.0f), m_rng(seed)
 {
-    // Seed the random number generator
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    m_zombies.Reserve(m_spawnPoints.size());
 
-    InitializeSpawnPoints();
+    if (m_isHeadless) {
+        // Simulation only: zombies get a plain square hitbox instead of a texture
+        for (const auto& point : m_spawnPoints) {
+            m_zombies.EmplaceEachKind(static_cast<const sf::Texture*>(nullptr), point);
+        }
+        return;
+    }
 
     // --- SETUP GRAVE SPRITE ---
     const sf::Texture& graveTex = assetSupplier->GetTexture("grave");
@@ -33,50 +56,53 @@ ZombieManager::ZombieManager(IAssetSupplier* assetSupplier)
     // --------------------------
 
     // Create the Zombie Pool
-    // We create one zombie for each spawn point to prevent overlap.
+    // We create one zombie of each kind for each spawn point. Only one of them
+    // may be up at a time, which prevents overlap.
     // They start in the "Hidden" state.
     const sf::Texture& zombieTexture = assetSupplier->GetTexture("zombie_head"); // Ensure this name matches your asset!
 
     for (const auto& point : m_spawnPoints) {
-        m_zombies.push_back(std::make_unique<StandardZombie>(zombieTexture, point));
+        m_zombies.EmplaceEachKind(&zombieTexture, point);
     }
 }
 
 ZombieManager::~ZombieManager() {
-    // unique_ptr handles cleanup automatically
+    // The pool stores zombies by value; vectors clean up automatically
 }
 
-void ZombieManager::InitializeSpawnPoints() {
+std::vector<sf::Vector2f> ZombieManager::DefaultSpawnPoints() {
     // Define 6 distinct positions on an 800x600 screen.
     // We arrange them in a grid for tidiness.
-    // Row 1
-    m_spawnPoints.emplace_back(200.0f, 200.0f);
-    m_spawnPoints.emplace_back(400.0f, 200.0f);
-    m_spawnPoints.emplace_back(600.0f, 200.0f);
-    
-    // Row 2
-    m_spawnPoints.emplace_back(200.0f, 400.0f);
-    m_spawnPoints.emplace_back(400.0f, 400.0f);
-    m_spawnPoints.emplace_back(600.0f, 400.0f);
+    return {
+        // Row 1
+        sf::Vector2f(200.0f, 200.0f),
+        sf::Vector2f(400.0f, 200.0f),
+        sf::Vector2f(600.0f, 200.0f),
+
+        // Row 2
+        sf::Vector2f(200.0f, 400.0f),
+        sf::Vector2f(400.0f, 400.0f),
+        sf::Vector2f(600.0f, 400.0f)
+    };
 }
 
 int ZombieManager::Update(float deltaTime) {
     int missesThisFrame = 0;
 
-    // 1. Update all existing zombies
-    for (auto& zombie : m_zombies) {
+    // 1. Update all existing zombies (one statically dispatched loop per kind)
+    m_zombies.ForEach([&](auto& zombie) {
         // If Update() returns true, it means the zombie escaped.
-        if (zombie->Update(deltaTime)) {
+        if (zombie.Update(deltaTime)) {
             missesThisFrame++;
         }
-    }
+    });
 
     // 2. Handle Spawning Logic
     m_spawnTimer += deltaTime;
     if (m_spawnTimer >= m_nextSpawnTime) {
         SpawnRandomZombie();
         m_spawnTimer = 0.0f;
-        m_nextSpawnTime = MIN_SPAWN_TIME + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (MAX_SPAWN_TIME - MIN_SPAWN_TIME)));
+        m_nextSpawnTime = (MIN_SPAWN_TIME + RandomUnit() * (MAX_SPAWN_TIME - MIN_SPAWN_TIME)) * m_spawnIntervalScale;
     }
 
     return missesThisFrame;
@@ -87,15 +113,14 @@ void ZombieManager::SpawnRandomZombie() {
     // We try a few times to find a free spot. If all are busy, we skip this spawn.
     int attempts = 0;
     while (attempts < 10) {
-        int index = std::rand() % m_zombies.size();
+        std::size_t slot = m_rng() % m_spawnPoints.size();
         
-        // We need to cast to StandardZombie to access the Spawn() method
-        // because the vector holds IWhackable pointers.
-        // In a pure ECS, we would handle this differently, but dynamic_cast is safe here.
-        StandardZombie* z = dynamic_cast<StandardZombie*>(m_zombies[index].get());
+        // A grave is free only if none of its kinds is currently up
+        bool occupied = m_zombies.AnyInSlot(slot, [](const auto& z) { return z.IsActive(); });
         
-        if (z && !z->IsActive()) {
-            z->Spawn();
+        if (!occupied) {
+            m_zombies.VisitKind(PickZombieKind(), slot, [&](auto& z) { z.Spawn(m_lifetimeScale, m_reactionFloor); });
+            if (m_effectListener) m_effectListener->OnZombieSpawned(m_spawnPoints[slot]);
             return; // Success
         }
         attempts++;
@@ -103,7 +128,27 @@ void ZombieManager::SpawnRandomZombie() {
     // If we get here, the screen is likely full of zombies.
 }
 
+void ZombieManager::HideAll() {
+    m_zombies.ForEach([](auto& zombie) { zombie.Reset(); });
+}
+
+void ZombieManager::SetDifficulty(float spawnIntervalScale, float lifetimeScale, float reactionFloor) {
+    m_spawnIntervalScale = spawnIntervalScale;
+    m_lifetimeScale = lifetimeScale;
+    m_reactionFloor = reactionFloor;
+}
+
+std::size_t ZombieManager::PickZombieKind() {
+    return PickWeightedKind(m_zombies, RandomUnit());
+}
+
+float ZombieManager::RandomUnit() {
+    return std::uniform_real_distribution<float>(0.0f, 1.0f)(m_rng);
+}
+
 void ZombieManager::Render(sf::RenderWindow& window) {
+    if (m_isHeadless) return; // Nothing to draw with
+
     // 1. Draw Graves at all spawn points
     for (const auto& point : m_spawnPoints) {
         m_graveSprite.setPosition(point);
@@ -111,18 +156,31 @@ void ZombieManager::Render(sf::RenderWindow& window) {
     }
 
     // 2. Draw Zombies (on top of graves)
-    for (auto& zombie : m_zombies) {
-        zombie->Render(window);
-    }
+    m_zombies.ForEach([&](const auto& zombie) {
+        zombie.Render(window);
+    });
 }
 
-bool ZombieManager::HandleClick(int x, int y) {
+HitResult ZombieManager::HandleClick(int x, int y, float* reactionTime) {
     // Check if the click hit any ACTIVE zombie
     // We iterate backwards so if zombies overlap, we hit the one "on top" first.
-    for (auto it = m_zombies.rbegin(); it != m_zombies.rend(); ++it) {
-        if ((*it)->TryHit(x, y)) {
-            return true; // Hit registered!
-        }
-    }
-    return false; // Missed everything
+    // Stops at the first zombie struck; None if we missed everything.
+    HitResult result = HitResult::None;
+    m_zombies.FindReverse([&](auto& zombie) {
+        result = zombie.TryHit(x, y);
+        if (result != HitResult::Killed) return result == HitResult::Absorbed;
+
+        if (reactionTime) *reactionTime = zombie.GetReactionTime();
+        if (m_effectListener) m_effectListener->OnZombieHit(zombie.GetPosition());
+        return true;
+    });
+    return result;
+}
+
+int ZombieManager::GetActiveCount() const {
+    int count = 0;
+    m_zombies.ForEach([&](const auto& zombie) {
+        if (zombie.IsActive()) count++;
+    });
+    return count;
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ----------------------------------------------------------------
+// PerfHarness
+// Description: A tiny timing harness for the performance regression suite.
+// Each measurement runs an untimed setup, then a timed batch of operations,
+// repeatedly until enough time has passed. The reported figure is the
+// median nanoseconds per operation across batches (robust to hiccups).
+//
+// Baselines are flat JSON objects: { "case/variant": nanosecondsPerOp, ... }
+// ----------------------------------------------------------------
+
+struct PerfResult {
+    std::string name;
+    double nsPerOp;
+};
+
+class PerfHarness {
+public:
+    explicit PerfHarness(double minSeconds) : m_minSeconds(minSeconds) {}
+
+    // setup runs before every batch and is not timed; batch must perform opsPerBatch operations
+    void Measure(const std::string& name, std::size_t opsPerBatch,
+                 const std::function<void()>& setup, const std::function<void()>& batch) {
+        using Clock = std::chrono::steady_clock;
+        const int MIN_BATCHES = 5;
+
+        // Warm-up (caches, lazy statics, branch predictors)
+        setup();
+        batch();
+
+        std::vector<double> samples;
+        double elapsed = 0.0;
+        while (elapsed < m_minSeconds || static_cast<int>(samples.size()) < MIN_BATCHES) {
+            setup();
+            Clock::time_point start = Clock::now();
+            batch();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            samples.push_back(seconds * 1e9 / static_cast<double>(opsPerBatch));
+            elapsed += seconds;
+        }
+
+        std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2), samples.end());
+        m_results.push_back(PerfResult{ name, samples[samples.size() / 2] });
+        std::cout << "[Perf] " << std::left << std::setw(32) << name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << m_results.back().nsPerOp << " ns/op" << std::endl;
+    }
+
+    const std::vector<PerfResult>& GetResults() const { return m_results; }
+
+private:
+    double m_minSeconds;
+    std::vector<PerfResult> m_results;
+};
+
+// ----------------------------------------------------------------
+// Baseline Files
+// ----------------------------------------------------------------
+
+// Minimal reader for a flat object of "name": number pairs.
+// Returns false if the file is missing or malformed.
+inline bool LoadBaseline(const std::string& path, std::map<std::string, double>& baseline) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    std::size_t pos = text.find('{');
+    if (pos == std::string::npos) return false;
+
+    while (true) {
+        std::size_t keyStart = text.find('"', pos);
+        if (keyStart == std::string::npos) break;
+        std::size_t keyEnd = text.find('"', keyStart + 1);
+        std::size_t colon = text.find(':', keyEnd);
+        if (keyEnd == std::string::npos || colon == std::string::npos) return false;
+
+        const char* numberStart = text.c_str() + colon + 1;
+        char* numberEnd = nullptr;
+        double value = std::strtod(numberStart, &numberEnd);
+        if (numberEnd == numberStart) return false;
+
+        baseline[text.substr(keyStart + 1, keyEnd - keyStart - 1)] = value;
+        pos = static_cast<std::size_t>(numberEnd - text.c_str());
+    }
+    return true;
+}
+
+inline bool SaveBaseline(const std::string& path, const std::vector<PerfResult>& results) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) return false;
+
+    file << "{\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        file << "  \"" << results[i].name << "\": " << std::fixed << std::setprecision(1) << results[i].nsPerOp;
+        file << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "}\n";
+    return static_cast<bool>(file);
+}
+
+// Prints a comparison table. Returns the number of failures: regressions
+// beyond tolerance, plus (if requireBaseline) results with no baseline entry.
+// Otherwise results with no entry are reported as NEW and never fail.
+inline int CompareToBaseline(const std::vector<PerfResult>& results, const std::map<std::string, double>& baseline,
+                             double tolerance, bool requireBaseline) {
+    int regressions = 0;
+    for (const PerfResult& result : results) {
+        auto found = baseline.find(result.name);
+        std::cout << "[Perf] " << std::left << std::setw(32) << result.name << std::right;
+
+        if (found == baseline.end() || found->second <= 0.0) {
+            if (requireBaseline) {
+                regressions++;
+                std::cout << "  MISSING (record it with --update-baseline)" << std::endl;
+            } else {
+                std::cout << "  NEW (no baseline)" << std::endl;
+            }
+            continue;
+        }
+
+        double change = result.nsPerOp / found->second - 1.0;
+        bool regressed = change > tolerance;
+        if (regressed) regressions++;
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(12) << found->second << " -> "
+                  << std::setw(12) << result.nsPerOp << " ns/op  (" << std::showpos << change * 100.0
+                  << std::noshowpos << "%)  " << (regressed ? "REGRESSION" : "ok") << std::endl;
+    }
+    return regressions;
+}
@@ -0,0 +1,307 @@
+// ----------------------------------------------------------------
+// PerfSuite
+// Description: Performance regression suite for the game's hot paths.
+// Run through CTest (label "perf"), one test per case, each compared
+// against its committed baseline in tests/perf/baselines/.
+//
+// Usage:
+//   PerfSuite --case <name|all> [--baseline file.json] [--tolerance 0.25]
+//             [--min-time seconds] [--require-baseline | --update-baseline]
+//
+// Cases: zombie_update, click_resolution, spawn_selection (each on boards
+// of 6, 1k and 100k graves), hud_format, asset_load, texture_load.
+// Runs against ./assets; CTest uses a copy in the build tree, because
+// asset_load deletes and rewrites the sound's PCM cache.
+// ----------------------------------------------------------------
+#include "PerfHarness.h"
+#include "../../include/ZombieManager.h"
+#include "../../include/ResourceManager.h"
+#include "../../include/HUD.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <random>
+
+// CTest treats this exit code as "skipped" (see SKIP_RETURN_CODE in CMakeLists.txt)
+const int EXIT_SKIPPED = 77;
+
+const std::size_t BOARD_SIZES[] = { 6, 1000, 100000 };
+const float GRAVE_SPACING = 200.0f;
+const float FRAME_TIME = 1.0f / 60.0f;
+
+// Keeps results alive so the optimiser can't delete the work
+volatile long long g_sink = 0;
+
+// A square-ish grid of graves, spaced like the real board
+std::vector<sf::Vector2f> MakeBoard(std::size_t graves) {
+    std::size_t columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(graves))));
+    std::vector<sf::Vector2f> points;
+    points.reserve(graves);
+    for (std::size_t i = 0; i < graves; ++i) {
+        points.emplace_back(GRAVE_SPACING * static_cast<float>(i % columns + 1), GRAVE_SPACING * static_cast<float>(i / columns + 1));
+    }
+    return points;
+}
+
+// SFML creates a GL context for any sf::Texture. On Linux/BSD that means an
+// X11 connection, and SFML 2.6 aborts the process instead of failing when
+// there is none, so check before trying.
+bool HasDisplay() {
+#if defined(__unix__) && !defined(__APPLE__)
+    return std::getenv("DISPLAY") != nullptr;
+#else
+    return true;
+#endif
+}
+
+// Half the graves occupied: the busy steady state of a real game
+void PopulateHalf(ZombieManager& manager) {
+    manager.HideAll();
+    for (std::size_t i = 0; i < manager.GetSpawnPoints().size() / 2; ++i) {
+        manager.SpawnRandomZombie();
+    }
+}
+
+// ----------------------------------------------------------------
+// Cases
+// ----------------------------------------------------------------
+
+int RunZombieUpdate(PerfHarness& harness) {
+    for (std::size_t graves : BOARD_SIZES) {
+        ZombieManager manager(nullptr, 42, MakeBoard(graves));
+
+        // One op = one frame of ZombieManager::Update (one second per batch)
+        harness.Measure("zombie_update/" + std::to_string(graves), 60,
+            [&] { PopulateHalf(manager); },
+            [&] {
+                for (int frame = 0; frame < 60; ++frame) {
+                    g_sink += manager.Update(FRAME_TIME);
+                }
+            });
+    }
+    return 0;
+}
+
+int RunClickResolution(PerfHarness& harness) {
+    const std::size_t CLICKS = 256;
+
+    for (std::size_t graves : BOARD_SIZES) {
+        ZombieManager manager(nullptr, 42, MakeBoard(graves));
+
+        // Clicks land on random graves (a mix of hits and full-scan misses)
+        std::minstd_rand rng(7);
+        std::vector<sf::Vector2i> clicks;
+        for (std::size_t i = 0; i < CLICKS; ++i) {
+            const sf::Vector2f& grave = manager.GetSpawnPoints()[rng() % graves];
+            clicks.emplace_back(static_cast<int>(grave.x), static_cast<int>(grave.y));
+        }
+
+        harness.Measure("click_resolution/" + std::to_string(graves), CLICKS,
+            [&] {
+                PopulateHalf(manager);
+                manager.Update(0.35f); // Past every kind's spawn animation, so zombies are hittable
+            },
+            [&] {
+                for (const sf::Vector2i& click : clicks) {
+                    g_sink += static_cast<int>(manager.HandleClick(click.x, click.y));
+                }
+            });
+    }
+    return 0;
+}
+
+int RunSpawnSelection(PerfHarness& harness) {
+    for (std::size_t graves : BOARD_SIZES) {
+        ZombieManager manager(nullptr, 42, MakeBoard(graves));
+        std::size_t spawns = std::max<std::size_t>(1, graves / 2);
+
+        // Fill an empty board to half: one op = one SpawnRandomZombie
+        harness.Measure("spawn_selection/" + std::to_string(graves), spawns,
+            [&] { manager.HideAll(); },
+            [&] {
+                for (std::size_t i = 0; i < spawns; ++i) {
+                    manager.SpawnRandomZombie();
+                }
+            });
+        g_sink += manager.GetActiveCount();
+    }
+    return 0;
+}
+
+// Changing numbers every op, like a real game
+class CountingTelemetry : public ITelemetry {
+public:
+    int GetScore() const override { return m_score; }
+    int GetMisses() const override { return m_score / 3; }
+    float GetAccuracy() const override { return 75.0f + static_cast<float>(m_score % 100) * 0.1f; }
+
+    int m_score = 0;
+};
+
+int RunHudFormat(PerfHarness& harness) {
+    ResourceManager resources;
+    if (!resources.LoadFont("game_font", "arial.ttf")) {
+        std::cerr << "[Perf] Skipping hud_format: font not found in ./assets" << std::endl;
+        return EXIT_SKIPPED;
+    }
+
+    CountingTelemetry telemetry;
+    HUD hud(&telemetry, &resources);
+
+    const int UPDATES = 1000;
+    harness.Measure("hud_format", UPDATES,
+        [] {},
+        [&] {
+            for (int i = 0; i < UPDATES; ++i) {
+                telemetry.m_score++;
+                hud.Update();
+            }
+        });
+    return 0;
+}
+
+int RunAssetLoad(PerfHarness& harness) {
+    const std::string cachePath = "assets/sounds/hit.mp3.pcm";
+
+    {
+        ResourceManager probe;
+        if (!probe.LoadFont("game_font", "arial.ttf")) {
+            std::cerr << "[Perf] Skipping asset_load: ./assets not found" << std::endl;
+            return EXIT_SKIPPED;
+        }
+    }
+
+    // Cold: mp3 decode + writing the PCM cache
+    harness.Measure("asset_load/sound_decode", 1,
+        [&] { std::remove(cachePath.c_str()); },
+        [] {
+            ResourceManager resources;
+            g_sink += resources.LoadSound("hit", "hit.mp3") ? 1 : 0;
+        });
+
+    // Warm: straight from the PCM cache written above
+    harness.Measure("asset_load/sound_cached", 1,
+        [] {},
+        [] {
+            ResourceManager resources;
+            g_sink += resources.LoadSound("hit", "hit.mp3") ? 1 : 0;
+        });
+
+    harness.Measure("asset_load/font", 1,
+        [] {},
+        [] {
+            ResourceManager resources;
+            g_sink += resources.LoadFont("game_font", "arial.ttf") ? 1 : 0;
+        });
+
+    return 0;
+}
+
+int RunTextureLoad(PerfHarness& harness) {
+    if (!HasDisplay()) {
+        std::cerr << "[Perf] Skipping texture_load: no display for a graphics context" << std::endl;
+        return EXIT_SKIPPED;
+    }
+    if (!std::ifstream("assets/textures/zombie.png")) {
+        std::cerr << "[Perf] Skipping texture_load: ./assets not found" << std::endl;
+        return EXIT_SKIPPED;
+    }
+
+    harness.Measure("texture_load", 1,
+        [] {},
+        [] {
+            ResourceManager resources;
+            g_sink += resources.LoadTexture("zombie_head", "zombie.png") ? 1 : 0;
+        });
+    return 0;
+}
+
+// ----------------------------------------------------------------
+// Entry Point
+// ----------------------------------------------------------------
+
+int RunCase(const std::string& name, PerfHarness& harness) {
+    if (name == "zombie_update") return RunZombieUpdate(harness);
+    if (name == "click_resolution") return RunClickResolution(harness);
+    if (name == "spawn_selection") return RunSpawnSelection(harness);
+    if (name == "hud_format") return RunHudFormat(harness);
+    if (name == "asset_load") return RunAssetLoad(harness);
+    if (name == "texture_load") return RunTextureLoad(harness);
+
+    std::cerr << "[Perf] Error: Unknown case " << name << std::endl;
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    std::string caseName;
+    std::string baselinePath;
+    double tolerance = 0.25;
+    double minSeconds = 0.3;
+    bool updateBaseline = false;
+    bool requireBaseline = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--update-baseline") {
+            updateBaseline = true;
+        } else if (arg == "--require-baseline") {
+            requireBaseline = true;
+        } else if (i + 1 < argc && arg == "--case") {
+            caseName = argv[++i];
+        } else if (i + 1 < argc && arg == "--baseline") {
+            baselinePath = argv[++i];
+        } else if (i + 1 < argc && arg == "--tolerance") {
+            tolerance = std::stod(argv[++i]);
+        } else if (i + 1 < argc && arg == "--min-time") {
+            minSeconds = std::stod(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " --case <name|all> [--baseline file.json] [--tolerance 0.25]"
+                      << " [--min-time seconds] [--require-baseline | --update-baseline]" << std::endl;
+            return 1;
+        }
+    }
+    if (caseName.empty()) {
+        std::cerr << "[Perf] Error: --case is required" << std::endl;
+        return 1;
+    }
+
+#ifndef NDEBUG
+    std::cerr << "[Perf] Warning: built without optimisations; numbers are not comparable to the baselines" << std::endl;
+#endif
+
+    PerfHarness harness(minSeconds);
+    int status = 0;
+    if (caseName == "all") {
+        for (const char* name : { "zombie_update", "click_resolution", "spawn_selection", "hud_format", "asset_load", "texture_load" }) {
+            int caseStatus = RunCase(name, harness);
+            if (caseStatus != 0 && caseStatus != EXIT_SKIPPED) status = caseStatus;
+        }
+    } else {
+        status = RunCase(caseName, harness);
+    }
+    if (status != 0) return status;
+
+    if (baselinePath.empty()) return 0;
+
+    if (updateBaseline) {
+        if (!SaveBaseline(baselinePath, harness.GetResults())) {
+            std::cerr << "[Perf] Error: Could not write " << baselinePath << std::endl;
+            return 1;
+        }
+        std::cout << "[Perf] Baseline written to " << baselinePath << std::endl;
+        return 0;
+    }
+
+    std::map<std::string, double> baseline;
+    if (!LoadBaseline(baselinePath, baseline)) {
+        std::cerr << "[Perf] Warning: No readable baseline at " << baselinePath << std::endl;
+    }
+
+    int failures = CompareToBaseline(harness.GetResults(), baseline, tolerance, requireBaseline);
+    if (failures > 0) {
+        std::cerr << "[Perf] " << failures << " result(s) slower than " << tolerance * 100.0
+                  << "% tolerance" << (requireBaseline ? " or missing from the baseline" : "") << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------
+// WhackAZombieServer
+// Description: Headless, score-authoritative host for many game sessions.
+//
+// Usage:
+//   WhackAZombieServer [--sessions N] [--threads T]
+//       Pipe mode. Steps all sessions at 60 Hz and reads client commands
+//       from stdin (a stand-in for a local socket), one per line:
+//           click <session> <x> <y>
+//           stats
+//           quit
+//       Prints the final scoreboard on quit / end of input.
+//
+//   WhackAZombieServer --load <seconds> [--sessions N] [--threads T]
+//       Built-in load driver. Simulated clients click on every session while
+//       the host steps as fast as it can, then reports how many 60 Hz
+//       sessions one worker thread can sustain.
+// ----------------------------------------------------------------
+#include "../include/SessionHost.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+const float TICK_RATE = 60.0f;
+const float TICK_TIME = 1.0f / TICK_RATE;
+
+// Load driver: chance that a simulated client clicks on a given tick
+// (about 3 clicks per second per player)
+const float CLICK_CHANCE = 0.05f;
+
+struct ServerOptions {
+    std::size_t sessions = 100;
+    std::size_t threads = 0; // 0 = one per hardware thread
+    float loadSeconds = 0.0f; // > 0 runs the load driver
+};
+
+bool ParseOptions(int argc, char** argv, ServerOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "[Server] Error: Missing value for " << arg << std::endl;
+            return false;
+        }
+        try {
+            if (arg == "--sessions") {
+                options.sessions = std::stoul(argv[++i]);
+            } else if (arg == "--threads") {
+                options.threads = std::stoul(argv[++i]);
+            } else if (arg == "--load") {
+                options.loadSeconds = std::stof(argv[++i]);
+            } else {
+                std::cerr << "[Server] Error: Unknown option " << arg << std::endl;
+                return false;
+            }
+        } catch (const std::exception&) {
+            // stoul/stof throw on non-numeric or out-of-range input
+            std::cerr << "[Server] Error: Invalid value for " << arg << ": " << argv[i] << std::endl;
+            return false;
+        }
+    }
+
+    if (options.threads == 0) {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return true;
+}
+
+void PrintScoreboard(const SessionHost& host) {
+    long long totalScore = 0;
+    long long totalMisses = 0;
+    for (std::size_t i = 0; i < host.GetSessionCount(); ++i) {
+        totalScore += host.GetSession(i).GetScore();
+        totalMisses += host.GetSession(i).GetMisses();
+    }
+
+    std::cout << "[Server] Sessions: " << host.GetSessionCount()
+              << " | Total score: " << totalScore
+              << " | Total misses: " << totalMisses << std::endl;
+
+    // Individual lines only for small deployments
+    if (host.GetSessionCount() <= 16) {
+        for (std::size_t i = 0; i < host.GetSessionCount(); ++i) {
+            const GameSession& session = host.GetSession(i);
+            std::cout << "  #" << i << " Score: " << session.GetScore()
+                      << " | Misses: " << session.GetMisses()
+                      << " | Accuracy: " << std::fixed << std::setprecision(1) << session.GetAccuracy() << "%" << std::endl;
+        }
+    }
+}
+
+// ----------------------------------------------------------------
+// Pipe Mode
+// ----------------------------------------------------------------
+
+int RunPipe(SessionHost& host) {
+    std::atomic<bool> inputOpen(true);
+    std::atomic<bool> statsRequested(false);
+
+    // The only thread that submits clicks (keeps each inbox single-producer)
+    std::thread reader([&] {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            std::istringstream command(line);
+            std::string verb;
+            command >> verb;
+
+            if (verb == "click") {
+                std::size_t id;
+                int x, y;
+                if (command >> id >> x >> y) {
+                    if (!host.SubmitClick(id, x, y)) {
+                        std::cerr << "[Server] Dropped click for session " << id << std::endl;
+                    }
+                    continue;
+                }
+            } else if (verb == "stats") {
+                statsRequested = true;
+                continue;
+            } else if (verb == "quit") {
+                break;
+            } else if (verb.empty()) {
+                continue;
+            }
+            std::cerr << "[Server] Bad command: " << line << std::endl;
+        }
+        inputOpen = false;
+    });
+
+    auto nextTick = std::chrono::steady_clock::now();
+    while (inputOpen) {
+        host.Step(TICK_TIME);
+
+        if (statsRequested.exchange(false)) {
+            PrintScoreboard(host);
+        }
+
+        nextTick += std::chrono::microseconds(static_cast<long long>(TICK_TIME * 1000000.0f));
+        std::this_thread::sleep_until(nextTick);
+    }
+
+    reader.join();
+    // Apply whatever was queued after the last tick
+    host.Step(0.0f);
+    PrintScoreboard(host);
+    return 0;
+}
+
+// ----------------------------------------------------------------
+// Load Driver
+// ----------------------------------------------------------------
+
+int RunLoad(SessionHost& host, float seconds) {
+    std::minstd_rand rng(1234);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<int> jitter(-60, 60);
+
+    // Aim at the graves (every session shares the same layout)
+    const GameSession& layout = host.GetSession(0);
+    const std::vector<sf::Vector2f>& targets = layout.GetZombieManager().GetSpawnPoints();
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const Clock::duration budget = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(seconds));
+    Clock::duration stepTime = Clock::duration::zero();
+    long long ticks = 0;
+
+    while (Clock::now() - start < budget) {
+        // Simulated clients (this thread is the single producer)
+        for (std::size_t id = 0; id < host.GetSessionCount(); ++id) {
+            if (unit(rng) < CLICK_CHANCE) {
+                const sf::Vector2f& target = targets[rng() % targets.size()];
+                host.SubmitClick(id, static_cast<int>(target.x) + jitter(rng), static_cast<int>(target.y) + jitter(rng));
+            }
+        }
+
+        Clock::time_point stepStart = Clock::now();
+        host.Step(TICK_TIME);
+        stepTime += Clock::now() - stepStart;
+        ticks++;
+    }
+
+    double stepSeconds = std::chrono::duration<double>(stepTime).count();
+    double sessionSteps = static_cast<double>(ticks) * static_cast<double>(host.GetSessionCount());
+    double stepsPerSecond = stepSeconds > 0.0 ? sessionSteps / stepSeconds : 0.0;
+    // Per worker thread, not per core: threads may exceed cores, and with SMT
+    // hardware_concurrency() counts logical CPUs
+    double sessionsPerThread = stepsPerSecond / TICK_RATE / static_cast<double>(host.GetThreadCount());
+
+    PrintScoreboard(host);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "[Server] Load: " << ticks << " ticks x " << host.GetSessionCount() << " sessions on "
+              << host.GetThreadCount() << " threads in " << stepSeconds << " s of stepping" << std::endl;
+    std::cout << "[Server] Session steps/s: " << std::setprecision(0) << stepsPerSecond << std::endl;
+    std::cout << "[Server] Sessions per worker thread @ " << TICK_RATE << " Hz: " << sessionsPerThread << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    ServerOptions options;
+    if (!ParseOptions(argc, argv, options) || options.sessions == 0) {
+        std::cerr << "Usage: " << argv[0] << " [--sessions N] [--threads T] [--load SECONDS]" << std::endl;
+        return 1;
+    }
+
+    SessionHost host(options.threads);
+    for (std::size_t i = 0; i < options.sessions; ++i) {
+        host.CreateSession(static_cast<unsigned int>(i + 1));
+    }
+    std::cout << "[Server] Hosting " << host.GetSessionCount() << " sessions on "
+              << host.GetThreadCount() << " threads" << std::endl;
+
+    if (options.loadSeconds > 0.0f) {
+        return RunLoad(host, options.loadSeconds);
+    }
+    return RunPipe(host);
+}
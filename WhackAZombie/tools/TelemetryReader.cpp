@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------
+// TelemetryReader
+// Description: Command-line reader for .wazt session recordings.
+//
+// Usage:
+//   TelemetryReader <file.wazt>          Print a session summary
+//   TelemetryReader <file.wazt> --csv    Dump every record as CSV
+// ----------------------------------------------------------------
+#include "../include/TelemetryFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct TelemetryColumns {
+    std::vector<float> time;
+    std::vector<float> value;
+    std::vector<std::uint16_t> activeZombies;
+    std::vector<std::uint8_t> event;
+};
+
+template <typename T>
+bool ReadColumn(std::ifstream& file, std::vector<T>& column, std::uint32_t count) {
+    std::size_t offset = column.size();
+    column.resize(offset + count);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(column.data() + offset), static_cast<std::streamsize>(count * sizeof(T))));
+}
+
+bool LoadTelemetry(const std::string& path, TelemetryColumns& columns) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "[TelemetryReader] Error: Could not open " << path << std::endl;
+        return false;
+    }
+
+    TelemetryFileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, TELEMETRY_MAGIC, 4) != 0) {
+        std::cerr << "[TelemetryReader] Error: Not a telemetry file: " << path << std::endl;
+        return false;
+    }
+    if (header.version != TELEMETRY_VERSION) {
+        std::cerr << "[TelemetryReader] Error: Unsupported version " << header.version << std::endl;
+        return false;
+    }
+
+    std::uint32_t count = 0;
+    while (file.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+        if (count == 0 || count > header.blockCapacity) {
+            std::cerr << "[TelemetryReader] Error: Corrupt block (count " << count << ")" << std::endl;
+            return false;
+        }
+        std::size_t complete = columns.time.size();
+        if (!ReadColumn(file, columns.time, count) || !ReadColumn(file, columns.value, count) ||
+            !ReadColumn(file, columns.activeZombies, count) || !ReadColumn(file, columns.event, count)) {
+            // A truncated tail (e.g. the game crashed mid-write) keeps everything before it
+            std::cerr << "[TelemetryReader] Warning: Truncated block, ignoring the rest" << std::endl;
+            columns.time.resize(complete);
+            columns.value.resize(complete);
+            columns.activeZombies.resize(complete);
+            columns.event.resize(complete);
+            break;
+        }
+    }
+    return true;
+}
+
+const char* EventName(std::uint8_t event) {
+    switch (static_cast<TelemetryEvent>(event)) {
+        case TelemetryEvent::Frame: return "frame";
+        case TelemetryEvent::Hit: return "hit";
+        case TelemetryEvent::Miss: return "miss";
+        case TelemetryEvent::Escape: return "escape";
+        default: return "unknown";
+    }
+}
+
+void PrintCsv(const TelemetryColumns& columns) {
+    std::cout << "time,event,value,active_zombies\n";
+    for (std::size_t i = 0; i < columns.time.size(); ++i) {
+        std::cout << columns.time[i] << ',' << EventName(columns.event[i]) << ','
+                  << columns.value[i] << ',' << columns.activeZombies[i] << '\n';
+    }
+}
+
+float Percentile(std::vector<float> values, float fraction) {
+    if (values.empty()) return 0.0f;
+    std::size_t index = static_cast<std::size_t>(fraction * static_cast<float>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+void PrintSummary(const TelemetryColumns& columns) {
+    std::vector<float> frameTimes;
+    std::vector<float> reactionTimes;
+    int misses = 0;
+    int escapes = 0;
+    double activeSum = 0.0;
+
+    for (std::size_t i = 0; i < columns.time.size(); ++i) {
+        switch (static_cast<TelemetryEvent>(columns.event[i])) {
+            case TelemetryEvent::Frame:
+                frameTimes.push_back(columns.value[i]);
+                activeSum += columns.activeZombies[i];
+                break;
+            case TelemetryEvent::Hit: reactionTimes.push_back(columns.value[i]); break;
+            case TelemetryEvent::Miss: misses++; break;
+            case TelemetryEvent::Escape: escapes++; break;
+        }
+    }
+
+    float duration = columns.time.empty() ? 0.0f : columns.time.back();
+    std::size_t shots = reactionTimes.size() + static_cast<std::size_t>(misses + escapes);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Session length:   " << duration << " s (" << columns.time.size() << " records)\n";
+    std::cout << "Frames:           " << frameTimes.size() << "\n";
+    if (!frameTimes.empty()) {
+        std::cout << "Frame time (ms):  median " << Percentile(frameTimes, 0.5f) * 1000.0f
+                  << " | p95 " << Percentile(frameTimes, 0.95f) * 1000.0f
+                  << " | p99 " << Percentile(frameTimes, 0.99f) * 1000.0f
+                  << " | max " << *std::max_element(frameTimes.begin(), frameTimes.end()) * 1000.0f << "\n";
+        std::cout << "Active zombies:   " << activeSum / static_cast<double>(frameTimes.size()) << " avg\n";
+    }
+    std::cout << "Hits:             " << reactionTimes.size() << "\n";
+    std::cout << "Misses (clicks):  " << misses << "\n";
+    std::cout << "Escapes:          " << escapes << "\n";
+    if (shots > 0) {
+        std::cout << "Accuracy:         " << 100.0 * static_cast<double>(reactionTimes.size()) / static_cast<double>(shots) << " %\n";
+    }
+    if (!reactionTimes.empty()) {
+        std::cout << "Reaction (ms):    median " << Percentile(reactionTimes, 0.5f) * 1000.0f
+                  << " | p95 " << Percentile(reactionTimes, 0.95f) * 1000.0f << "\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file.wazt> [--csv]" << std::endl;
+        return 1;
+    }
+
+    TelemetryColumns columns;
+    if (!LoadTelemetry(argv[1], columns)) {
+        return 1;
+    }
+
+    if (argc >= 3 && std::string(argv[2]) == "--csv") {
+        PrintCsv(columns);
+    } else {
+        PrintSummary(columns);
+    }
+    return 0;
+}